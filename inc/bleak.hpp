@@ -7,33 +7,43 @@
 #include <bleak/array.hpp>
 #include <bleak/atlas.hpp>
 #include <bleak/binarray.hpp>
+#include <bleak/bitboard.hpp>
 #include <bleak/bitdef.hpp>
 #include <bleak/camera.hpp>
 #include <bleak/cardinal.hpp>
 #include <bleak/circle.hpp>
 #include <bleak/clip_pool.hpp>
 #include <bleak/clock.hpp>
+#include <bleak/codec.hpp>
 #include <bleak/color.hpp>
 #include <bleak/concepts.hpp>
 #include <bleak/constants.hpp>
 #include <bleak/creeper.hpp>
 #include <bleak/cursor.hpp>
+#include <bleak/delta.hpp>
+#include <bleak/dirty.hpp>
+#include <bleak/distance.hpp>
 #include <bleak/extent.hpp>
 #include <bleak/field.hpp>
+#include <bleak/flow.hpp>
 #include <bleak/glyph.hpp>
 #include <bleak/hash.hpp>
 #include <bleak/input.hpp>
 #include <bleak/iter.hpp>
 #include <bleak/keyboard.hpp>
 #include <bleak/keyframe.hpp>
+#include <bleak/label.hpp>
+#include <bleak/layout.hpp>
 #include <bleak/leaf.hpp>
 #include <bleak/line.hpp>
 #include <bleak/log.hpp>
 #include <bleak/lut.hpp>
+#include <bleak/mapped_file.hpp>
 #include <bleak/memory.hpp>
 #include <bleak/mixer.hpp>
 #include <bleak/mouse.hpp>
 #include <bleak/music.hpp>
+#include <bleak/noise.hpp>
 #include <bleak/octant.hpp>
 #include <bleak/offset.hpp>
 #include <bleak/path.hpp>
@@ -41,18 +51,27 @@
 #include <bleak/primitive.hpp>
 #include <bleak/priority_mutex.hpp>
 #include <bleak/quadrant.hpp>
+#include <bleak/radix.hpp>
 #include <bleak/random.hpp>
 #include <bleak/rect.hpp>
 #include <bleak/region.hpp>
 #include <bleak/renderer.hpp>
+#include <bleak/ring.hpp>
+#include <bleak/sampler.hpp>
 #include <bleak/saturate.hpp>
+#include <bleak/sightline.hpp>
+#include <bleak/simd.hpp>
+#include <bleak/snapshot.hpp>
 #include <bleak/sound.hpp>
 #include <bleak/sparse.hpp>
 #include <bleak/sprite.hpp>
 #include <bleak/steam.hpp>
+#include <bleak/stencil.hpp>
+#include <bleak/storage.hpp>
 #include <bleak/subsystem.hpp>
 #include <bleak/text.hpp>
 #include <bleak/texture.hpp>
+#include <bleak/thread_pool.hpp>
 #include <bleak/timer.hpp>
 #include <bleak/tree.hpp>
 #include <bleak/triangle.hpp>
@@ -62,4 +81,6 @@
 #include <bleak/wave.hpp>
 #include <bleak/window.hpp>
 #include <bleak/zone.hpp>
+#include <bleak/zone_span.hpp>
+#include <bleak/zone_view.hpp>
 // IWYU pragma: end_exports
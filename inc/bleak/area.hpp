@@ -12,6 +12,7 @@
 #include <bleak/circle.hpp>
 #include <bleak/concepts.hpp>
 #include <bleak/extent.hpp>
+#include <bleak/label.hpp>
 #include <bleak/octant.hpp>
 #include <bleak/offset.hpp>
 #include <bleak/zone.hpp>
@@ -790,42 +791,35 @@ namespace bleak {
 			return *this;
 		}
 
-		template<typename T, extent_t Size, extent_t BorderSize> static std::vector<area_t> partition(cref< zone_t<T, Size, BorderSize>> zone, cref<T> value) {
-			std::vector<area_t> partitions{};
-
-			area_t values{};
-			values.collect(zone, value);
+		// one area per labeled component, each reserved to its final size up front
+		template<extent_t Size> static std::vector<area_t> partition(cref<label_map_t<Size>> labels) {
+			std::vector<area_t> partitions(labels.count());
 
-			while (!values.empty()) {
-				area_t partition{};
+			for (u32 i{ 0 }; i < labels.count(); ++i) {
+				partitions[i].reserve(labels.component(i + 1).size);
+			}
 
-				partition.flood(zone, *values.begin(), value);
-				values.remove(partition);
+			for (extent_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+					const u32 label{ labels[x, y] };
 
-				partitions.push_back(std::move(partition));
+					if (label != label_map_t<Size>::background) {
+						partitions[label - 1].emplace(x, y);
+					}
+				}
 			}
 
 			return partitions;
 		}
 
+		template<typename T, extent_t Size, extent_t BorderSize> static std::vector<area_t> partition(cref< zone_t<T, Size, BorderSize>> zone, cref<T> value) {
+			return partition(label_map_t<Size>{}.label(zone, value));
+		}
+
 		template<typename T, typename U, extent_t Size, extent_t BorderSize>
 			requires is_equatable<T, U>::value
 		static std::vector<area_t> partition(cref< zone_t<T, Size, BorderSize>> zone, cref<U> value) {
-			std::vector<area_t> partitions{};
-
-			area_t values{};
-			values.collect(zone, value);
-
-			while (!values.empty()) {
-				area_t partition{};
-
-				partition.flood(zone, *values.begin(), value);
-				values.remove(partition);
-
-				partitions.push_back(std::move(partition));
-			}
-
-			return partitions;
+			return partition(label_map_t<Size>{}.label(zone, value));
 		}
 
 	  private:
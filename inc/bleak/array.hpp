@@ -4,20 +4,24 @@
 
 #include <array>
 #include <initializer_list>
+#include <iterator>
 #include <type_traits>
 
 #include <bleak/concepts.hpp>
 #include <bleak/extent.hpp>
 #include <bleak/hash.hpp>
 #include <bleak/iter.hpp>
+#include <bleak/layout.hpp>
 #include <bleak/log.hpp>
 #include <bleak/offset.hpp>
+#include <bleak/storage.hpp>
 #include <bleak/utility.hpp>
+#include <bleak/zone_span.hpp>
 
 namespace bleak {
-	template<typename T, extent_t Size> struct array_t {
+	template<typename T, extent_t Size, storage_e Storage = storage_policy<T, Size>::value, layout_e Layout = layout_policy<T, Size>::value> struct array_t {
 	  private:
-		std::array<T, Size.area()> data;
+		storage_t<T, static_cast<usize>(Size.area()), Storage> data;
 
 	  public:
 		static constexpr extent_t size{ Size };
@@ -26,8 +30,12 @@ namespace bleak {
 
 		static constexpr usize byte_size{ area * sizeof(T) };
 
+		static constexpr storage_e storage{ Storage };
+		static constexpr layout_e layout{ Layout };
+
+		using layout_type = layout_t<Size, Layout>;
+
 		static_assert(area > 0, "array size must have a size greater than zero!");
-		static_assert(area * sizeof(T) <= memory::Maximum, "array size must not exceed the maximum!");
 
 		static constexpr usize first{ 0 };
 		static constexpr usize last{ area - 1 };
@@ -35,41 +43,42 @@ namespace bleak {
 		static constexpr extent_t::scalar_t width{ size.w };
 		static constexpr extent_t::scalar_t height{ size.h };
 
-		static inline constexpr usize flatten(offset_t offset) noexcept { return static_cast<usize>(offset.y) * Size.w + offset.x; }
+		static inline constexpr usize flatten(offset_t offset) noexcept { return layout_type::flatten(offset); }
 
-		static inline constexpr usize flatten(offset_t::scalar_t i, offset_t::scalar_t j) noexcept { return static_cast<usize>(j) * Size.w + i; }
+		static inline constexpr usize flatten(offset_t::scalar_t i, offset_t::scalar_t j) noexcept { return layout_type::flatten(i, j); }
 
-		static inline constexpr offset_t unflatten(usize index) noexcept { return offset_t{ index / Size.w, index % Size.w }; }
+		static inline constexpr offset_t unflatten(usize index) noexcept { return layout_type::unflatten(index); }
 
 		using iterator = fwd_iter_t<T>;
 		using const_iterator = fwd_iter_t<const T>;
 
-		using reverse_iterator = rev_iter_t<T>;
-		using const_reverse_iterator = rev_iter_t<const T>;
+		// reverse iterators run over [begin, end) and step back before dereferencing, so rend never forms a pointer before the first element
+		using reverse_iterator = std::reverse_iterator<ptr<T>>;
+		using const_reverse_iterator = std::reverse_iterator<cptr<T>>;
 
-		inline constexpr iterator begin() noexcept { return data.begin(); }
+		inline constexpr iterator begin() noexcept { return data.data(); }
 
-		inline constexpr iterator end() noexcept { return data.end(); }
+		inline constexpr iterator end() noexcept { return data.data() + area; }
 
-		inline constexpr const_iterator begin() const noexcept { return data.begin(); }
+		inline constexpr const_iterator begin() const noexcept { return data.data(); }
 
-		inline constexpr const_iterator end() const noexcept { return data.end(); }
+		inline constexpr const_iterator end() const noexcept { return data.data() + area; }
 
-		inline constexpr const_iterator cbegin() const noexcept { return data.cbegin(); }
+		inline constexpr const_iterator cbegin() const noexcept { return data.data(); }
 
-		inline constexpr const_iterator cend() const noexcept { return data.cend(); }
+		inline constexpr const_iterator cend() const noexcept { return data.data() + area; }
 
-		inline constexpr reverse_iterator rbegin() noexcept { return data.rbegin(); }
+		inline constexpr reverse_iterator rbegin() noexcept { return reverse_iterator{ data.data() + area }; }
 
-		inline constexpr reverse_iterator rend() noexcept { return data.rend(); }
+		inline constexpr reverse_iterator rend() noexcept { return reverse_iterator{ data.data() }; }
 
-		inline constexpr const_reverse_iterator rbegin() const noexcept { return data.rbegin(); }
+		inline constexpr const_reverse_iterator rbegin() const noexcept { return const_reverse_iterator{ data.data() + area }; }
 
-		inline constexpr const_reverse_iterator rend() const noexcept { return data.rend(); }
+		inline constexpr const_reverse_iterator rend() const noexcept { return const_reverse_iterator{ data.data() }; }
 
-		inline constexpr const_reverse_iterator crbegin() const noexcept { return data.crbegin(); }
+		inline constexpr const_reverse_iterator crbegin() const noexcept { return const_reverse_iterator{ data.data() + area }; }
 
-		inline constexpr const_reverse_iterator crend() const noexcept { return data.crend(); }
+		inline constexpr const_reverse_iterator crend() const noexcept { return const_reverse_iterator{ data.data() }; }
 
 		inline constexpr ref<T> front() noexcept { return data[first]; }
 
@@ -164,11 +173,18 @@ namespace bleak {
 
 		inline constexpr cref<T> operator[](offset_t::scalar_t i, offset_t::scalar_t j) const noexcept { return data[first + flatten(i, j)]; }
 
-		inline constexpr bool valid(offset_t offset) const noexcept { return flatten(offset) < area; }
+		inline constexpr bool valid(offset_t offset) const noexcept { return valid(offset.x, offset.y); }
 
 		inline constexpr bool valid(offset_t::product_t index) const noexcept { return index < area; }
 
-		inline constexpr bool valid(offset_t::scalar_t i, offset_t::scalar_t j) const noexcept { return flatten(i, j) < area; }
+		// only row-major indices stay ordered for positions beyond the extent, so other layouts are bounds checked per axis
+		inline constexpr bool valid(offset_t::scalar_t i, offset_t::scalar_t j) const noexcept {
+			if constexpr (Layout == layout_e::RowMajor) {
+				return flatten(i, j) < area;
+			} else {
+				return i >= 0 && i < width && j >= 0 && j < height;
+			}
+		}
 
 		inline constexpr ref<T> at(offset_t offset) {
 			if (!valid(offset)) {
@@ -218,9 +234,34 @@ namespace bleak {
 			return data[first + flatten(i, j)];
 		}
 
-		constexpr ptr<T> data_ptr() noexcept { return data; }
+		constexpr ptr<T> data_ptr() noexcept { return data.data(); }
+
+		constexpr cptr<T> data_ptr() const noexcept { return data.data(); }
+
+		// non-owning views over the elements or a rectangle of them clipped to the array; only row-major arrays have rows to view
+		constexpr zone_span_t<T> span() noexcept
+			requires(Layout == layout_e::RowMajor)
+		{
+			return zone_span_t<T>{ data.data(), offset_t{ 0, 0 }, size, static_cast<usize>(width) };
+		}
+
+		constexpr zone_span_t<const T> span() const noexcept
+			requires(Layout == layout_e::RowMajor)
+		{
+			return zone_span_t<const T>{ data.data(), offset_t{ 0, 0 }, size, static_cast<usize>(width) };
+		}
+
+		constexpr zone_span_t<T> span(offset_t origin, extent_t extent) noexcept
+			requires(Layout == layout_e::RowMajor)
+		{
+			return span().subspan(origin, extent);
+		}
 
-		constexpr cptr<T> data_ptr() const noexcept { return data; }
+		constexpr zone_span_t<const T> span(offset_t origin, extent_t extent) const noexcept
+			requires(Layout == layout_e::RowMajor)
+		{
+			return span().subspan(origin, extent);
+		}
 
 		constexpr bool operator==(cref<array_t> other) const noexcept {
 			for (usize i{0}; i < area; ++i) {
@@ -243,7 +284,7 @@ namespace bleak {
 		}
 
 		struct hasher {
-			static constexpr usize operator()(cref<array_t<T, Size>> array) { return hash_array(array.begin(), array.end()); }
+			static constexpr usize operator()(cref<array_t<T, Size, Storage, Layout>> array) { return hash_array(array.begin(), array.end()); }
 		};
 	};
 } // namespace bleak
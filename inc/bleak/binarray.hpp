@@ -116,6 +116,13 @@ namespace bleak {
 
 		inline constexpr ~binarray_t() noexcept {}
 
+		// clears every bit without releasing the storage
+		inline constexpr ref<binarray_t> reset() noexcept {
+			data.reset();
+
+			return *this;
+		}
+
 		inline constexpr bit_ref operator[](offset_t offset) noexcept { return data[first + flatten(offset)]; }
 
 		inline constexpr bool operator[](offset_t offset) const noexcept { return data[first + flatten(offset)]; }
@@ -0,0 +1,246 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <bit>
+
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/log.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/storage.hpp>
+#include <bleak/utility.hpp>
+
+namespace bleak {
+	// row-major board of packed bits; each row starts on a fresh word so neighbourhoods of sixty-four cells can be evaluated at once
+	template<extent_t Size> struct bitboard_t {
+		using word_t = u64;
+
+		static constexpr usize word_bits{ sizeof(word_t) * 8 };
+
+		static constexpr usize row_words{ (static_cast<usize>(Size.w) + word_bits - 1) / word_bits };
+
+		static constexpr usize word_count{ row_words * Size.h };
+
+		static constexpr usize byte_size{ word_count * sizeof(word_t) };
+
+		static_assert(word_count > 0, "bitboard size must have a size greater than zero!");
+		static_assert(byte_size <= memory::Maximum, "bitboard size must not exceed the maximum!");
+
+		static constexpr extent_t::scalar_t width{ Size.w };
+		static constexpr extent_t::scalar_t height{ Size.h };
+
+		// boards follow the storage policy of array_t, so those of large zones live on the heap rather than the stack
+		static constexpr storage_e storage{ byte_size > memory::InlineLimit ? storage_e::Heap : storage_e::Inline };
+
+		// bits of the final word of each row that lie beyond the width of the board
+		static constexpr word_t padding_mask{ Size.w % word_bits == 0 ? word_t{ 0 } : ~word_t{ 0 } << (Size.w % word_bits) };
+
+	  private:
+		storage_t<word_t, word_count, storage> words;
+
+		static constexpr word_t full_adder(word_t a, word_t b, word_t c, ref<word_t> carry) noexcept {
+			const word_t partial{ a ^ b };
+
+			carry = (a & b) | (c & partial);
+
+			return partial ^ c;
+		}
+
+		static constexpr word_t half_adder(word_t a, word_t b, ref<word_t> carry) noexcept {
+			carry = a & b;
+
+			return a ^ b;
+		}
+
+	  public:
+		static inline constexpr usize flatten(extent_t::scalar_t word, extent_t::scalar_t row) noexcept { return static_cast<usize>(row) * row_words + word; }
+
+		inline constexpr bitboard_t() noexcept : words{} {}
+
+		inline constexpr bitboard_t(cref<bitboard_t> other) noexcept : words{ other.words } {}
+
+		inline constexpr bitboard_t(rval<bitboard_t> other) noexcept : words{ std::move(other.words) } {}
+
+		inline constexpr ref<bitboard_t> operator=(cref<bitboard_t> other) noexcept {
+			if (this != &other) {
+				words = other.words;
+			}
+
+			return *this;
+		}
+
+		inline constexpr ref<bitboard_t> operator=(rval<bitboard_t> other) noexcept {
+			if (this != &other) {
+				words = std::move(other.words);
+			}
+
+			return *this;
+		}
+
+		inline constexpr ~bitboard_t() noexcept {}
+
+		inline constexpr bool operator[](offset_t position) const noexcept { return (words[flatten(position.x / word_bits, position.y)] >> (position.x % word_bits)) & 1; }
+
+		inline constexpr bool operator[](offset_t::scalar_t x, offset_t::scalar_t y) const noexcept { return (words[flatten(x / word_bits, y)] >> (x % word_bits)) & 1; }
+
+		inline constexpr void set(offset_t position, bool state) noexcept { set(position.x, position.y, state); }
+
+		inline constexpr void set(offset_t::scalar_t x, offset_t::scalar_t y, bool state) noexcept {
+			const word_t bit{ word_t{ 1 } << (x % word_bits) };
+
+			if (state) {
+				words[flatten(x / word_bits, y)] |= bit;
+			} else {
+				words[flatten(x / word_bits, y)] &= ~bit;
+			}
+		}
+
+		inline constexpr ptr<word_t> row(extent_t::scalar_t y) noexcept { return words.data() + flatten(0, y); }
+
+		inline constexpr cptr<word_t> row(extent_t::scalar_t y) const noexcept { return words.data() + flatten(0, y); }
+
+		inline constexpr ptr<word_t> data_ptr() noexcept { return words.data(); }
+
+		inline constexpr cptr<word_t> data_ptr() const noexcept { return words.data(); }
+
+		constexpr ref<bitboard_t> fill(bool state) noexcept {
+			std::fill_n(words.data(), word_count, state ? ~word_t{ 0 } : word_t{ 0 });
+
+			return *this;
+		}
+
+		// sets every bit of the inclusive span [first, last] on a single row
+		constexpr ref<bitboard_t> fill(extent_t::scalar_t y, extent_t::scalar_t first, extent_t::scalar_t last, bool state) noexcept {
+			if (first > last) {
+				return *this;
+			}
+
+			const usize first_word{ static_cast<usize>(first) / word_bits };
+			const usize last_word{ static_cast<usize>(last) / word_bits };
+
+			for (usize i{ first_word }; i <= last_word; ++i) {
+				word_t span{ ~word_t{ 0 } };
+
+				if (i == first_word) {
+					span &= ~word_t{ 0 } << (first % word_bits);
+				}
+
+				if (i == last_word && (last % word_bits) != word_bits - 1) {
+					span &= ~(~word_t{ 0 } << (last % word_bits + 1));
+				}
+
+				if (state) {
+					words[flatten(i, y)] |= span;
+				} else {
+					words[flatten(i, y)] &= ~span;
+				}
+			}
+
+			return *this;
+		}
+
+		constexpr usize count() const noexcept {
+			usize total{ 0 };
+
+			for (extent_t::scalar_t y{ 0 }; y < height; ++y) {
+				for (usize i{ 0 }; i < row_words; ++i) {
+					word_t word{ words[flatten(i, y)] };
+
+					if (i == row_words - 1) {
+						word &= ~padding_mask;
+					}
+
+					total += std::popcount(word);
+				}
+			}
+
+			return total;
+		}
+
+		// fetches a word with every bit beyond the board reading as set
+		constexpr word_t fetch(isize word, isize row) const noexcept {
+			if (row < 0 || row >= height || word < 0 || word >= static_cast<isize>(row_words)) {
+				return ~word_t{ 0 };
+			}
+
+			return word == static_cast<isize>(row_words) - 1 ? words[flatten(word, row)] | padding_mask : words[flatten(word, row)];
+		}
+
+		// advances rows [first_row, last_row] of a moore automaton by one generation; cells beyond the board count as set
+		// masked bits above the threshold are set, those below are cleared and those equal to it (or unmasked) are carried over from the buffer
+		static constexpr void automatize(ref<bitboard_t> next, cref<bitboard_t> current, cref<bitboard_t> buffer, cref<bitboard_t> mask, u8 threshold, extent_t::scalar_t first_row, extent_t::scalar_t last_row) noexcept {
+			for (extent_t::scalar_t y{ first_row }; y <= last_row; ++y) {
+				for (isize i{ 0 }; i < static_cast<isize>(row_words); ++i) {
+					const word_t north_west{ current.fetch(i - 1, y - 1) };
+					const word_t north{ current.fetch(i, y - 1) };
+					const word_t north_east{ current.fetch(i + 1, y - 1) };
+
+					const word_t west{ current.fetch(i - 1, y) };
+					const word_t central{ current.fetch(i, y) };
+					const word_t east{ current.fetch(i + 1, y) };
+
+					const word_t south_west{ current.fetch(i - 1, y + 1) };
+					const word_t south{ current.fetch(i, y + 1) };
+					const word_t south_east{ current.fetch(i + 1, y + 1) };
+
+					const word_t neighbours[8]{
+						(north << 1) | (north_west >> (word_bits - 1)),
+						north,
+						(north >> 1) | (north_east << (word_bits - 1)),
+						(central << 1) | (west >> (word_bits - 1)),
+						(central >> 1) | (east << (word_bits - 1)),
+						(south << 1) | (south_west >> (word_bits - 1)),
+						south,
+						(south >> 1) | (south_east << (word_bits - 1)),
+					};
+
+					word_t carry_a, carry_b, carry_c, carry_d, carry_e, carry_f;
+
+					const word_t sum_a{ full_adder(neighbours[0], neighbours[1], neighbours[2], carry_a) };
+					const word_t sum_b{ full_adder(neighbours[3], neighbours[4], neighbours[5], carry_b) };
+					const word_t sum_c{ half_adder(neighbours[6], neighbours[7], carry_c) };
+
+					const word_t sum_d{ full_adder(carry_a, carry_b, carry_c, carry_e) };
+
+					// bit-sliced neighbour count; planes[n] holds bit n of the count for each of the sixty-four cells
+					word_t planes[4]{};
+
+					planes[0] = full_adder(sum_a, sum_b, sum_c, carry_d);
+					planes[1] = half_adder(sum_d, carry_d, carry_f);
+					planes[2] = carry_e ^ carry_f;
+					planes[3] = carry_e & carry_f;
+
+					word_t greater{ 0 };
+					word_t equal{ ~word_t{ 0 } };
+
+					if (threshold > 8) {
+						equal = 0;
+					} else {
+						for (i32 b{ 3 }; b >= 0; --b) {
+							if ((threshold >> b) & 1) {
+								equal &= planes[b];
+							} else {
+								greater |= equal & planes[b];
+								equal &= ~planes[b];
+							}
+						}
+					}
+
+					const usize index{ flatten(i, y) };
+
+					next.words[index] = (mask.words[index] & (greater | (equal & buffer.words[index]))) | (~mask.words[index] & buffer.words[index]);
+				}
+			}
+		}
+
+		static constexpr void automatize(ref<bitboard_t> next, cref<bitboard_t> current, cref<bitboard_t> buffer, cref<bitboard_t> mask, u8 threshold) noexcept {
+			automatize(next, current, buffer, mask, threshold, 0, height - 1);
+		}
+
+		constexpr bool operator==(cref<bitboard_t> other) const noexcept { return std::equal(words.data(), words.data() + word_count, other.words.data()); }
+
+		constexpr bool operator!=(cref<bitboard_t> other) const noexcept { return !(*this == other); }
+	};
+} // namespace bleak
@@ -0,0 +1,215 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <cstring>
+#include <istream>
+#include <ostream>
+#include <type_traits>
+
+#include <bleak/extent.hpp>
+#include <bleak/log.hpp>
+
+namespace bleak {
+	namespace codec {
+		enum struct compression_e : u8 {
+			None,
+			RunLength
+		};
+
+		static constexpr u32 Magic{ 0x5A4B4C42 }; // "BLKZ" in file order
+		static constexpr u16 Version{ 1 };
+
+		// fixed-size header preceding every encoded zone or region; multi-byte fields are stored in native (little-endian) order
+		struct header_t {
+			u32 magic;
+			u16 version;
+			u16 type_size;
+
+			i32 zone_width;
+			i32 zone_height;
+
+			i32 border_width;
+			i32 border_height;
+
+			i32 region_width;
+			i32 region_height;
+
+			compression_e compression;
+			u8 reserved[7];
+
+			// fnv-1a over the raw cell bytes of every zone in storage order
+			u64 checksum;
+
+			constexpr header_t() noexcept :
+				magic{ Magic },
+				version{ Version },
+				type_size{ 0 },
+				zone_width{ 0 },
+				zone_height{ 0 },
+				border_width{ 0 },
+				border_height{ 0 },
+				region_width{ 1 },
+				region_height{ 1 },
+				compression{ compression_e::RunLength },
+				reserved{},
+				checksum{ 0 } {}
+
+			constexpr header_t(u16 type_size, extent_t zone_size, extent_t border_size, extent_t region_size, u64 checksum) noexcept :
+				magic{ Magic },
+				version{ Version },
+				type_size{ type_size },
+				zone_width{ zone_size.w },
+				zone_height{ zone_size.h },
+				border_width{ border_size.w },
+				border_height{ border_size.h },
+				region_width{ region_size.w },
+				region_height{ region_size.h },
+				compression{ compression_e::RunLength },
+				reserved{},
+				checksum{ checksum } {}
+
+			// whether a header read from a file describes the layout the caller expects; logs the first mismatch
+			constexpr bool matches(cref<header_t> expected) const noexcept {
+				if (magic != Magic) {
+					error_log.add("file is not an encoded zone or region!");
+					return false;
+				}
+
+				if (version != Version) {
+					error_log.add("unsupported encoding version {}!", version);
+					return false;
+				}
+
+				if (type_size != expected.type_size) {
+					error_log.add("cell size mismatch between file and map!");
+					return false;
+				}
+
+				if (zone_width != expected.zone_width || zone_height != expected.zone_height || border_width != expected.border_width || border_height != expected.border_height) {
+					error_log.add("zone extent mismatch between file and map!");
+					return false;
+				}
+
+				if (region_width != expected.region_width || region_height != expected.region_height) {
+					error_log.add("region extent mismatch between file and map!");
+					return false;
+				}
+
+				if (compression != compression_e::None && compression != compression_e::RunLength) {
+					error_log.add("unsupported compression scheme!");
+					return false;
+				}
+
+				return true;
+			}
+		};
+
+		static_assert(sizeof(header_t) == 48, "header layout must remain stable across builds!");
+
+		static constexpr u64 ChecksumSeed{ 0xCBF29CE484222325 };
+
+		constexpr u64 checksum(u64 seed, cptr<u8> bytes, usize length) noexcept {
+			for (usize i{ 0 }; i < length; ++i) {
+				seed ^= bytes[i];
+				seed *= 0x100000001B3;
+			}
+
+			return seed;
+		}
+
+		inline bool write_header(ref<std::ostream> stream, cref<header_t> header) noexcept {
+			stream.write(reinterpret_cast<cstr>(&header), sizeof(header_t));
+
+			return stream.good();
+		}
+
+		inline bool read_header(ref<std::istream> stream, ref<header_t> header) noexcept {
+			stream.read(reinterpret_cast<str>(&header), sizeof(header_t));
+
+			if (!stream.good()) {
+				error_log.add("failed to read encoding header!");
+				return false;
+			}
+
+			return true;
+		}
+
+		inline void write_varint(ref<std::ostream> stream, usize value) noexcept {
+			while (value >= 0x80) {
+				stream.put(static_cast<char>((value & 0x7F) | 0x80));
+				value >>= 7;
+			}
+
+			stream.put(static_cast<char>(value));
+		}
+
+		inline bool read_varint(ref<std::istream> stream, ref<usize> value) noexcept {
+			value = 0;
+
+			for (usize shift{ 0 }; shift < 64; shift += 7) {
+				const int byte{ stream.get() };
+
+				if (byte == std::char_traits<char>::eof()) {
+					return false;
+				}
+
+				value |= static_cast<usize>(byte & 0x7F) << shift;
+
+				if ((byte & 0x80) == 0) {
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		// each row is written as (run length, value) pairs that never cross into the next row, so decoding needs no more than a row of state
+		template<typename T>
+			requires std::is_trivially_copyable<T>::value
+		inline void encode_row(ref<std::ostream> stream, cptr<T> row, usize width) noexcept {
+			usize x{ 0 };
+
+			while (x < width) {
+				usize run{ 1 };
+
+				while (x + run < width && std::memcmp(&row[x + run], &row[x], sizeof(T)) == 0) {
+					++run;
+				}
+
+				write_varint(stream, run);
+				stream.write(reinterpret_cast<cstr>(&row[x]), sizeof(T));
+
+				x += run;
+			}
+		}
+
+		template<typename T>
+			requires std::is_trivially_copyable<T>::value
+		inline bool decode_row(ref<std::istream> stream, ptr<T> row, usize width) noexcept {
+			usize x{ 0 };
+
+			while (x < width) {
+				usize run{ 0 };
+
+				if (!read_varint(stream, run) || run == 0 || x + run > width) {
+					return false;
+				}
+
+				stream.read(reinterpret_cast<str>(&row[x]), sizeof(T));
+
+				if (!stream.good()) {
+					return false;
+				}
+
+				for (usize i{ 1 }; i < run; ++i) {
+					std::memcpy(&row[x + i], &row[x], sizeof(T));
+				}
+
+				x += run;
+			}
+
+			return true;
+		}
+	} // namespace codec
+} // namespace bleak
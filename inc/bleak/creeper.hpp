@@ -2,6 +2,9 @@
 
 #include <bleak/typedef.hpp>
 
+#include <array>
+#include <type_traits>
+
 #include <bleak/concepts.hpp>
 #include <bleak/hash.hpp>
 #include <bleak/memory.hpp>
@@ -46,7 +49,8 @@ namespace bleak {
 		};
 	};
 
-	template<distance_function_e Distance, Numeric D> static constexpr auto neighbourhood_creepers{
+	// fixed point measures the steps of a weighted neighbourhood in integral fifths, for fields whose distances cannot hold a diagonal of 1.414
+	template<distance_function_e Distance, Numeric D, bool FixedPoint = false> static constexpr auto neighbourhood_creepers{
 		[]() {
 			if constexpr (Distance == distance_function_e::VonNeumann || Distance == distance_function_e::Manhattan) {
 				return std::array<creeper_t<D>, 4>{
@@ -66,6 +70,18 @@ namespace bleak {
 					creeper_t<D>{ offset_t::Southwest, 1 },
 					creeper_t<D>{ offset_t::Southeast, 1 }
 				};
+			} else if constexpr (FixedPoint) {
+				// orthogonal steps of 5 and diagonal steps of 7 stand in for 1 and 1.414
+				return std::array<creeper_t<D>, 8>{
+					creeper_t<D>{ offset_t::North, 5 },
+					creeper_t<D>{ offset_t::South, 5 },
+					creeper_t<D>{ offset_t::West, 5 },
+					creeper_t<D>{ offset_t::East, 5 },
+					creeper_t<D>{ offset_t::Northwest, 7 },
+					creeper_t<D>{ offset_t::Northeast, 7 },
+					creeper_t<D>{ offset_t::Southwest, 7 },
+					creeper_t<D>{ offset_t::Southeast, 7 }
+				};
 			} else {
 				return std::array<creeper_t<D>, 8>{
 					creeper_t<D>{ offset_t::North, 1.0 },
@@ -80,4 +96,10 @@ namespace bleak {
 			}
 		}()
 	};
+
+	// whether steps of a neighbourhood differ in length, in which case distances must be settled in order rather than breadth first
+	template<distance_function_e Distance> constexpr bool is_weighted{ Distance == distance_function_e::Euclidean || Distance == distance_function_e::Octile };
+
+	// distance of one orthogonal step, by which distances of a weighted fixed point neighbourhood are scaled
+	template<distance_function_e Distance, Numeric D, bool FixedPoint = false> constexpr D step_scale{ is_weighted<Distance> && FixedPoint ? 5 : 1 };
 } // namespace bleak
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <vector>
+
+namespace bleak {
+	// runs of changed cells in storage order along with their new values; only meaningful for zones of the same type as the one it was taken from
+	template<typename T> struct zone_delta_t {
+		struct run_t {
+			u32 index;
+			u32 length;
+		};
+
+		std::vector<run_t> runs;
+		std::vector<T> values;
+
+		inline zone_delta_t() noexcept : runs{}, values{} {}
+
+		constexpr bool empty() const noexcept { return runs.empty(); }
+
+		// number of cells the delta writes
+		constexpr usize size() const noexcept { return values.size(); }
+
+		// bytes held by the runs and values, excluding any spare capacity
+		constexpr usize byte_size() const noexcept { return runs.size() * sizeof(run_t) + values.size() * sizeof(T); }
+
+		inline void clear() noexcept {
+			runs.clear();
+			values.clear();
+		}
+
+		// releases spare capacity so long-lived deltas cost no more than their contents
+		inline void shrink() noexcept {
+			runs.shrink_to_fit();
+			values.shrink_to_fit();
+		}
+	};
+} // namespace bleak
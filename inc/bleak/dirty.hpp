@@ -0,0 +1,181 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <array>
+#include <optional>
+#include <vector>
+
+#include <bleak/bitboard.hpp>
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/rect.hpp>
+#include <bleak/utility.hpp>
+
+namespace bleak {
+	// records writes at tile granularity so each consumer can ask what changed since it last cleared
+	// every write stamps its tile with the current revision and a consumer's tile is dirty while its stamp is newer than the consumer's cursor
+	template<extent_t Size, extent_t TileSize = extent_t{ 8, 8 }> struct dirty_t {
+		static_assert(TileSize > extent_t::Zero, "tile size must be greater than zero!");
+
+		using consumer_t = u32;
+
+		static constexpr extent_t zone_size{ Size };
+		static constexpr extent_t tile_size{ TileSize };
+
+		static constexpr extent_t tile_count{ (Size.w + TileSize.w - 1) / TileSize.w, (Size.h + TileSize.h - 1) / TileSize.h };
+
+		static constexpr usize tile_area{ static_cast<usize>(tile_count.area()) };
+
+		static constexpr offset_t to_tile(offset_t position) noexcept { return offset_t{ position.x / tile_size.w, position.y / tile_size.h }; }
+
+	  private:
+		static constexpr u64 Vacant{ ~u64{ 0 } };
+
+		std::array<u64, tile_area> stamps;
+		std::vector<u64> cursors;
+
+		u64 revision;
+
+		static constexpr usize flatten(offset_t::scalar_t x, offset_t::scalar_t y) noexcept { return static_cast<usize>(y) * tile_count.w + x; }
+
+		constexpr bool is_dirty(consumer_t consumer, usize tile) const noexcept { return stamps[tile] > cursors[consumer]; }
+
+	  public:
+		// tiles begin stamped so that a new consumer sees the whole zone as dirty
+		inline dirty_t() noexcept : stamps{}, cursors{}, revision{ 1 } { stamps.fill(revision); }
+
+		inline dirty_t(cref<dirty_t> other) noexcept : stamps{ other.stamps }, cursors{ other.cursors }, revision{ other.revision } {}
+
+		inline dirty_t(rval<dirty_t> other) noexcept : stamps{ std::move(other.stamps) }, cursors{ std::move(other.cursors) }, revision{ other.revision } {}
+
+		inline ref<dirty_t> operator=(cref<dirty_t> other) noexcept {
+			if (this != &other) {
+				stamps = other.stamps;
+				cursors = other.cursors;
+				revision = other.revision;
+			}
+
+			return *this;
+		}
+
+		inline ref<dirty_t> operator=(rval<dirty_t> other) noexcept {
+			if (this != &other) {
+				stamps = std::move(other.stamps);
+				cursors = std::move(other.cursors);
+				revision = other.revision;
+			}
+
+			return *this;
+		}
+
+		inline ~dirty_t() noexcept {}
+
+		inline consumer_t subscribe() noexcept {
+			for (usize i{ 0 }; i < cursors.size(); ++i) {
+				if (cursors[i] == Vacant) {
+					cursors[i] = 0;
+
+					return static_cast<consumer_t>(i);
+				}
+			}
+
+			cursors.push_back(0);
+
+			return static_cast<consumer_t>(cursors.size() - 1);
+		}
+
+		constexpr void unsubscribe(consumer_t consumer) noexcept {
+			if (consumer < cursors.size()) {
+				cursors[consumer] = Vacant;
+			}
+		}
+
+		constexpr bool is_subscribed(consumer_t consumer) const noexcept { return consumer < cursors.size() && cursors[consumer] != Vacant; }
+
+		constexpr void mark(offset_t position) noexcept {
+			const offset_t tile{ to_tile(position) };
+
+			stamps[flatten(tile.x, tile.y)] = revision;
+		}
+
+		// marks every tile overlapping the inclusive span [origin, extent]
+		constexpr void mark(offset_t origin, offset_t extent) noexcept {
+			const offset_t first{ to_tile(offset_t{ max<offset_t::scalar_t>(origin.x, 0), max<offset_t::scalar_t>(origin.y, 0) }) };
+			const offset_t last{ to_tile(offset_t{ min<offset_t::scalar_t>(extent.x, zone_size.w - 1), min<offset_t::scalar_t>(extent.y, zone_size.h - 1) }) };
+
+			for (offset_t::scalar_t y{ first.y }; y <= last.y; ++y) {
+				for (offset_t::scalar_t x{ first.x }; x <= last.x; ++x) {
+					stamps[flatten(x, y)] = revision;
+				}
+			}
+		}
+
+		constexpr void mark() noexcept { stamps.fill(revision); }
+
+		// forgets everything the consumer has seen so far; writes after this point stamp a newer revision
+		constexpr void clear(consumer_t consumer) noexcept {
+			cursors[consumer] = revision;
+
+			++revision;
+		}
+
+		constexpr bool is_dirty(consumer_t consumer, offset_t position) const noexcept {
+			const offset_t tile{ to_tile(position) };
+
+			return is_dirty(consumer, flatten(tile.x, tile.y));
+		}
+
+		constexpr bool any(consumer_t consumer) const noexcept {
+			for (usize i{ 0 }; i < tile_area; ++i) {
+				if (is_dirty(consumer, i)) {
+					return true;
+				}
+			}
+
+			return false;
+		}
+
+		// one bit per tile, set where the consumer has unseen writes
+		constexpr bitboard_t<tile_count> tiles(consumer_t consumer) const noexcept {
+			bitboard_t<tile_count> board{};
+
+			for (offset_t::scalar_t y{ 0 }; y < tile_count.h; ++y) {
+				for (offset_t::scalar_t x{ 0 }; x < tile_count.w; ++x) {
+					if (is_dirty(consumer, flatten(x, y))) {
+						board.set(x, y, true);
+					}
+				}
+			}
+
+			return board;
+		}
+
+		// cell bounds of every dirty tile, clamped to the zone; empty when nothing has changed
+		constexpr std::optional<rect_t> bounds(consumer_t consumer) const noexcept {
+			offset_t first{ tile_count.w, tile_count.h };
+			offset_t last{ -1, -1 };
+
+			for (offset_t::scalar_t y{ 0 }; y < tile_count.h; ++y) {
+				for (offset_t::scalar_t x{ 0 }; x < tile_count.w; ++x) {
+					if (!is_dirty(consumer, flatten(x, y))) {
+						continue;
+					}
+
+					first = offset_t{ min(first.x, x), min(first.y, y) };
+					last = offset_t{ max(last.x, x), max(last.y, y) };
+				}
+			}
+
+			if (last.x < 0) {
+				return std::nullopt;
+			}
+
+			const offset_t origin{ first.x * tile_size.w, first.y * tile_size.h };
+			const offset_t extent{ min<offset_t::scalar_t>((last.x + 1) * tile_size.w, zone_size.w) - 1, min<offset_t::scalar_t>((last.y + 1) * tile_size.h, zone_size.h) - 1 };
+
+			return rect_t{ origin, extent_t{ extent.x - origin.x + 1, extent.y - origin.y + 1 } };
+		}
+	};
+} // namespace bleak
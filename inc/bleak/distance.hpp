@@ -0,0 +1,203 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+#include <bleak/array.hpp>
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/thread_pool.hpp>
+#include <bleak/utility.hpp>
+#include <bleak/zone.hpp>
+
+namespace bleak {
+	// distance transforms measure how far every cell of a zone lies from the nearest feature cell, the features being the cells equal to a given value
+	namespace distance {
+		// written to every cell when the zone holds no feature at all; larger than any distance within the zone
+		template<extent_t Size> constexpr extent_t::scalar_t unreachable{ Size.w + Size.h };
+
+		// vertical distance to the nearest feature within the same column for columns [left, right), swept row by row so each step runs along contiguous cells
+		template<typename T, extent_t Size, extent_t BorderSize, typename U, typename D>
+		constexpr void columns(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, ref<array_t<D, Size>> out, extent_t::scalar_t left, extent_t::scalar_t right) noexcept {
+			constexpr D Unreachable{ static_cast<D>(unreachable<Size>) };
+
+			for (extent_t::scalar_t x{ left }; x < right; ++x) {
+				out[x, 0] = zone[x, 0] == value ? D{ 0 } : Unreachable;
+			}
+
+			for (extent_t::scalar_t y{ 1 }; y < Size.h; ++y) {
+				for (extent_t::scalar_t x{ left }; x < right; ++x) {
+					out[x, y] = zone[x, y] == value ? D{ 0 } : min<D>(out[x, y - 1] + D{ 1 }, Unreachable);
+				}
+			}
+
+			for (extent_t::scalar_t y{ Size.h - 2 }; y >= 0; --y) {
+				for (extent_t::scalar_t x{ left }; x < right; ++x) {
+					out[x, y] = min<D>(out[x, y], out[x, y + 1] + D{ 1 });
+				}
+			}
+		}
+
+		// replaces the vertical distances of row y with euclidean distances by taking the lower envelope of the parabolas rooted at each column
+		template<typename D, extent_t Size> constexpr void envelope(ref<array_t<D, Size>> out, extent_t::scalar_t y) noexcept {
+			std::array<f64, Size.w> heights;
+			std::array<extent_t::scalar_t, Size.w> roots;
+			std::array<f64, Size.w + 1> bounds;
+
+			for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+				const f64 height{ static_cast<f64>(out[x, y]) };
+
+				heights[x] = height * height;
+			}
+
+			// abscissa at which the parabola rooted at q overtakes the one rooted at r
+			const auto intersection{ [&](extent_t::scalar_t q, extent_t::scalar_t r) -> f64 {
+				return ((heights[q] + static_cast<f64>(q) * q) - (heights[r] + static_cast<f64>(r) * r)) / (2.0 * (q - r));
+			} };
+
+			usize k{ 0 };
+
+			roots[0] = 0;
+			bounds[0] = -std::numeric_limits<f64>::infinity();
+			bounds[1] = std::numeric_limits<f64>::infinity();
+
+			for (extent_t::scalar_t q{ 1 }; q < Size.w; ++q) {
+				f64 s{ intersection(q, roots[k]) };
+
+				while (s <= bounds[k]) {
+					--k;
+					s = intersection(q, roots[k]);
+				}
+
+				++k;
+
+				roots[k] = q;
+				bounds[k] = s;
+				bounds[k + 1] = std::numeric_limits<f64>::infinity();
+			}
+
+			k = 0;
+
+			for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+				while (bounds[k + 1] < x) {
+					++k;
+				}
+
+				const f64 run{ static_cast<f64>(x - roots[k]) };
+
+				out[x, y] = static_cast<D>(std::sqrt(run * run + heights[roots[k]]));
+			}
+		}
+
+		// exact euclidean distance transform after felzenszwalb and huttenlocher; a column pass followed by a row pass, each linear in the area of the zone
+		template<typename T, extent_t Size, extent_t BorderSize, typename U, typename D>
+			requires is_equatable<T, U>::value && std::is_floating_point<D>::value
+		constexpr void euclidean(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, ref<array_t<D, Size>> out) noexcept {
+			columns(zone, value, out, 0, Size.w);
+
+			for (extent_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+				envelope(out, y);
+			}
+		}
+
+		// columns and rows are independent within their pass, so each pass is split into bands across the pool
+		template<typename T, extent_t Size, extent_t BorderSize, typename U, typename D>
+			requires is_equatable<T, U>::value && std::is_floating_point<D>::value
+		inline void euclidean(ref<thread_pool_t> pool, cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, ref<array_t<D, Size>> out) noexcept {
+			pool.parallel_for(0, Size.w, [&](isize left, isize right) {
+				columns(zone, value, out, static_cast<extent_t::scalar_t>(left), static_cast<extent_t::scalar_t>(right));
+			});
+
+			pool.parallel_for(0, Size.h, [&](isize first_row, isize last_row) {
+				for (isize y{ first_row }; y < last_row; ++y) {
+					envelope(out, static_cast<extent_t::scalar_t>(y));
+				}
+			});
+		}
+
+		// step weights of the chamfer mask matching each distance function; manhattan and von neumann never step diagonally, and euclidean is approximated as octile
+		template<distance_function_e DistanceFunction, typename D> constexpr D orthogonal_weight{ 1 };
+
+		template<distance_function_e DistanceFunction, typename D> constexpr D diagonal_weight{ []() -> D {
+			if constexpr (DistanceFunction == distance_function_e::Chebyshev) {
+				return D{ 1 };
+			} else {
+				return static_cast<D>(1.41421356237309504880);
+			}
+		}() };
+
+		template<distance_function_e DistanceFunction> constexpr bool steps_diagonally{ DistanceFunction != distance_function_e::VonNeumann && DistanceFunction != distance_function_e::Manhattan };
+
+		// two raster passes of a 3x3 chamfer mask; each row first takes the row behind it in a branch-free step across the whole row, then sweeps along itself
+		// rows depend on the row before them, so unlike the euclidean transform the passes run on a single thread
+		template<distance_function_e DistanceFunction, typename T, extent_t Size, extent_t BorderSize, typename U, typename D>
+			requires is_equatable<T, U>::value && (std::is_floating_point<D>::value || DistanceFunction == distance_function_e::VonNeumann || DistanceFunction == distance_function_e::Manhattan || DistanceFunction == distance_function_e::Chebyshev)
+		constexpr void chamfer(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, ref<array_t<D, Size>> out) noexcept {
+			constexpr D Unreachable{ static_cast<D>(unreachable<Size>) };
+
+			constexpr D Orthogonal{ orthogonal_weight<DistanceFunction, D> };
+			constexpr D Diagonal{ diagonal_weight<DistanceFunction, D> };
+
+			constexpr bool Diagonals{ steps_diagonally<DistanceFunction> };
+
+			for (extent_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+					out[x, y] = zone[x, y] == value ? D{ 0 } : Unreachable;
+				}
+			}
+
+			for (extent_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+				if (y > 0) {
+					for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+						D candidate{ out[x, y - 1] + Orthogonal };
+
+						if constexpr (Diagonals) {
+							if (x > 0) {
+								candidate = min<D>(candidate, out[x - 1, y - 1] + Diagonal);
+							}
+
+							if (x < Size.w - 1) {
+								candidate = min<D>(candidate, out[x + 1, y - 1] + Diagonal);
+							}
+						}
+
+						out[x, y] = min<D>(out[x, y], candidate);
+					}
+				}
+
+				for (extent_t::scalar_t x{ 1 }; x < Size.w; ++x) {
+					out[x, y] = min<D>(out[x, y], out[x - 1, y] + Orthogonal);
+				}
+			}
+
+			for (extent_t::scalar_t y{ Size.h - 1 }; y >= 0; --y) {
+				if (y < Size.h - 1) {
+					for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+						D candidate{ out[x, y + 1] + Orthogonal };
+
+						if constexpr (Diagonals) {
+							if (x > 0) {
+								candidate = min<D>(candidate, out[x - 1, y + 1] + Diagonal);
+							}
+
+							if (x < Size.w - 1) {
+								candidate = min<D>(candidate, out[x + 1, y + 1] + Diagonal);
+							}
+						}
+
+						out[x, y] = min<D>(out[x, y], candidate);
+					}
+				}
+
+				for (extent_t::scalar_t x{ Size.w - 2 }; x >= 0; --x) {
+					out[x, y] = min<D>(out[x, y], out[x + 1, y] + Orthogonal);
+				}
+			}
+		}
+	} // namespace distance
+} // namespace bleak
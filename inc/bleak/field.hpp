@@ -2,29 +2,52 @@
 
 #include <bleak/typedef.hpp>
 
+#include <initializer_list>
+#include <limits>
 #include <optional>
-#include <queue>
-#include <unordered_set>
+#include <type_traits>
+#include <vector>
 
+#include <bleak/binarray.hpp>
 #include <bleak/concepts.hpp>
+#include <bleak/creeper.hpp>
 #include <bleak/extent.hpp>
+#include <bleak/flow.hpp>
 #include <bleak/octant.hpp>
 #include <bleak/offset.hpp>
 #include <bleak/sparse.hpp>
+#include <bleak/radix.hpp>
 #include <bleak/random.hpp>
+#include <bleak/ring.hpp>
 #include <bleak/zone.hpp>
 
 namespace bleak {
 	template<Numeric D> using goal_t = sparseling_t<D>;
 
-	template<Numeric D, distance_function_e DistanceFunction, extent_t ZoneSize, extent_t ZoneBorder> struct field_t {
+	// weighted fields over integral distances may opt into fixed point, which measures orthogonal steps as 5 and diagonal steps as 7 in place of 1 and 1.414
+	template<Numeric D, distance_function_e DistanceFunction, extent_t ZoneSize, extent_t ZoneBorder, bool FixedPoint = false> struct field_t {
+		static_assert(!FixedPoint || (is_weighted<DistanceFunction> && std::is_integral<D>::value), "fixed point is only meaningful for weighted fields over integral distances!");
+		static_assert(static_cast<f64>(ZoneSize.area()) * step_scale<DistanceFunction, D, FixedPoint> <= static_cast<f64>(std::numeric_limits<D>::max()), "distance type cannot hold the obstacle value of the field!");
+
 	  private:
 		zone_t<D, ZoneSize, ZoneBorder> distances;
 		sparse_t<goal_t<D>> goals;
 
+		// scratch reused by every recalculation so that steady-state recalculation does not allocate
+		binarray_t<ZoneSize> visited;
+		ring_t<offset_t> frontier;
+		radix_heap_t<offset_t, radix_key_t<D>> queue;
+		std::vector<offset_t> affected;
+
+		// held by the cells the last solve left unreached, which is obstacle_value after a recalculation and unreached_value after a traversal or sweep
+		D sentinel;
+
 	  public:
 		static constexpr D goal_value{ 0 };
-		static constexpr D obstacle_value{ ZoneSize.area() };
+		static constexpr D obstacle_value{ static_cast<D>(ZoneSize.area() * step_scale<DistanceFunction, D, FixedPoint>) };
+
+		// distances across terrain of varying cost may run past obstacle_value, so traversals and sweeps leave the cells they cannot reach at the largest distance instead
+		static constexpr D unreached_value{ std::numeric_limits<D>::max() };
 
 		static constexpr D close_to_obstacle_value{ obstacle_value - 1 };
 
@@ -32,43 +55,44 @@ namespace bleak {
 
 		constexpr bool goal_reached(offset_t position, D threshold) const noexcept { return distances[position] <= threshold; }
 
-		constexpr bool obstacle_reached(offset_t position) const noexcept { return distances[position] >= close_to_obstacle_value; }
+		constexpr bool obstacle_reached(offset_t position) const noexcept { return distances[position] >= sentinel - 1; }
 
-		constexpr bool obstacle_reached(offset_t position, D threshold) const noexcept { return distances[position] >= close_to_obstacle_value - threshold; }
+		constexpr bool obstacle_reached(offset_t position, D threshold) const noexcept { return distances[position] >= sentinel - 1 - threshold; }
 
-		constexpr field_t() noexcept : distances{}, goals{} { clear<zone_region_e::All>(); }
+		constexpr field_t() noexcept : distances{}, goals{}, visited{}, frontier{ static_cast<usize>(ZoneSize.area()) }, queue{}, affected{}, sentinel{ obstacle_value } { clear<zone_region_e::All>(); }
 
 		template<typename... Goals>
 			requires is_homogeneous<goal_t<D>, Goals...>::value
-		constexpr field_t(cref<Goals>... goals) noexcept : distances{}, goals{ goals... } {
+		constexpr field_t(cref<Goals>... goals) noexcept : distances{}, goals{ goals... }, visited{}, frontier{ static_cast<usize>(ZoneSize.area()) }, queue{}, affected{}, sentinel{ obstacle_value } {
 			clear<zone_region_e::All>();
 		}
 
 		template<typename T, typename... Goals>
 			requires is_homogeneous<goal_t<D>, Goals...>::value
-		constexpr field_t(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value, cref<Goals>... goals) noexcept : distances{}, goals{ goals... } {
+		constexpr field_t(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value, cref<Goals>... goals) noexcept : distances{}, goals{ goals... }, visited{}, frontier{ static_cast<usize>(ZoneSize.area()) }, queue{}, affected{}, sentinel{ obstacle_value } {
 			recalculate<zone_region_e::All>(zone, value);
 		}
 
 		template<typename... Goals>
 			requires is_homogeneous<goal_t<D>, Goals...>::value
-		constexpr field_t(rval<Goals>... goals) noexcept : distances{}, goals{ (std::move(goals), ...) } {
+		constexpr field_t(rval<Goals>... goals) noexcept : distances{}, goals{ (std::move(goals), ...) }, visited{}, frontier{ static_cast<usize>(ZoneSize.area()) }, queue{}, affected{}, sentinel{ obstacle_value } {
 			clear<zone_region_e::All>();
 		}
 
 		template<zone_region_e Region, typename T, typename... Goals>
 			requires is_homogeneous<goal_t<D>, Goals...>::value
-		constexpr field_t(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value, rval<Goals>... goals) noexcept : distances{}, goals{ (std::move(goals), ...) } {
+		constexpr field_t(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value, rval<Goals>... goals) noexcept : distances{}, goals{ (std::move(goals), ...) }, visited{}, frontier{ static_cast<usize>(ZoneSize.area()) }, queue{}, affected{}, sentinel{ obstacle_value } {
 			recalculate<zone_region_e::All>(zone, value);
 		}
 
-		template<zone_region_e Region> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> clear() noexcept {
+		template<zone_region_e Region> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, FixedPoint>> clear() noexcept {
 			distances.dependent set<Region>(obstacle_value);
+			sentinel = obstacle_value;
 
 			return *this;
 		}
 
-		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> reset() noexcept {
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, FixedPoint>> reset() noexcept {
 			clear<zone_region_e::All>();
 			goals.clear();
 
@@ -89,15 +113,36 @@ namespace bleak {
 			}
 		}
 
-		template<zone_region_e Region, typename T> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value) noexcept {
-			clear();
+	  private:
+		// whether every goal holds the same value, in which case breadth-first propagation reaches each cell first along a shortest path
+		constexpr bool uniform() const noexcept {
+			for (crauto goal : goals) {
+				if (goal.value != goals.begin()->value) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		// propagation from the goals across cells of the region equal to value that blocked rejects
+		// unweighted neighbourhoods from goals of one value spread breadth first, each cell marked visited and given its distance when first reached so it enters the frontier once
+		// weighted neighbourhoods, and goals of differing values whose waves would otherwise meet out of order, settle cells in order of distance through a radix heap,
+		// each cell marked visited when settled so its distance is final and written once more at most per shorter path found
+		// record is told of every distance written along with the offset towards the neighbour it was measured from, or zero for the goals
+		template<zone_region_e Region, typename T, typename U, typename Blocked, typename Record>
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, FixedPoint>> propagate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<Blocked> blocked, cref<Record> record) noexcept {
+			clear<Region>();
 
 			if (goals.empty()) {
 				return *this;
 			}
 
-			std::queue<creeper_t<D>> frontier{};
-			std::unordered_set<offset_t, offset_t::std_hasher> visited{};
+			visited.reset();
+			frontier.clear();
+			queue.clear();
+
+			const bool ordered{ is_weighted<DistanceFunction> || !uniform() };
 
 			bool negative_goal{ false };
 
@@ -106,37 +151,75 @@ namespace bleak {
 					continue;
 				}
 
-				frontier.emplace(goal.position, goal.value);
-
 				if (goal.value < 0) {
 					negative_goal = true;
 				}
-			}
 
-			if (frontier.empty()) {
-				return *this;
+				if (ordered) {
+					if (goal.value < distances[goal.position]) {
+						distances[goal.position] = goal.value;
+						record(goal.position, offset_t::Zero);
+						queue.push(radix_key(goal.value), goal.position);
+					}
+				} else {
+					if (visited[goal.position]) {
+						continue;
+					}
+
+					visited[goal.position] = true;
+					distances[goal.position] = goal.value;
+					record(goal.position, offset_t::Zero);
+					frontier.push(goal.position);
+				}
 			}
 
-			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.front() };
-				frontier.pop();
+			if (ordered) {
+				while (!queue.empty()) {
+					const offset_t current{ queue.pop().second };
 
-				visited.insert(current.position);
+					if (visited[current]) {
+						continue;
+					}
 
-				distances[current.position] = current.distance;
+					visited[current] = true;
 
-				for (cauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					const offset_t offset_position{ current.position + creeper.posititon };
+					const D current_distance{ distances[current] };
 
-					if (visited.contains(offset_position) || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value) {
-						if (!visited.contains(offset_position)) {
-							visited.insert(offset_position);
+					for (crauto creeper : neighbourhood_creepers<DistanceFunction, D, FixedPoint>) {
+						const offset_t offset_position{ current + creeper.position };
+
+						if (!zone.dependent within<Region>(offset_position) || visited[offset_position] || zone[offset_position] != value || blocked(offset_position)) {
+							continue;
 						}
 
-						continue;
+						const D offset_distance{ current_distance + creeper.distance };
+
+						if (offset_distance >= distances[offset_position]) {
+							continue;
+						}
+
+						distances[offset_position] = offset_distance;
+						record(offset_position, -creeper.position);
+						queue.push(radix_key(offset_distance), offset_position);
 					}
+				}
+			} else {
+				while (!frontier.empty()) {
+					const offset_t current{ frontier.pop() };
+					const D current_distance{ distances[current] };
+
+					for (crauto creeper : neighbourhood_creepers<DistanceFunction, D, FixedPoint>) {
+						const offset_t offset_position{ current + creeper.position };
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
+						if (!zone.dependent within<Region>(offset_position) || visited[offset_position] || zone[offset_position] != value || blocked(offset_position)) {
+							continue;
+						}
+
+						visited[offset_position] = true;
+						distances[offset_position] = D{ current_distance + creeper.distance };
+						record(offset_position, -creeper.position);
+						frontier.push(offset_position);
+					}
 				}
 			}
 
@@ -147,218 +230,326 @@ namespace bleak {
 			return *this;
 		}
 
-		template<zone_region_e Region, typename T, typename U>
-			requires is_equatable<T, U>::value
-		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value) noexcept {
-			clear<Region>();
+		template<zone_region_e Region, typename T, typename U, typename Blocked>
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, FixedPoint>> propagate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<Blocked> blocked) noexcept {
+			return propagate<Region>(zone, value, blocked, [](offset_t, offset_t) {});
+		}
 
-			if (goals.empty()) {
-				return *this;
-			}
+		// cost of a step onto a cell of the given cost, taken in the wider of the two types so that fractional costs are not truncated before scaling the step
+		template<Numeric C> static constexpr D toll(D step, C cost) noexcept { return static_cast<D>(step * cost); }
 
-			std::queue<creeper_t<D>> frontier{};
-			std::unordered_set<offset_t, offset_t::std_hasher> visited{};
+		// distance plus a toll, saturating at unreached_value so that paths from unreached cells stay unreached rather than overflowing
+		static constexpr D accrue(D distance, D step) noexcept { return distance >= unreached_value - step ? unreached_value : static_cast<D>(distance + step); }
 
-			bool negative_goal{ false };
+		// clears the region for a traversal or sweep, whose unreached cells hold unreached_value
+		template<zone_region_e Region> constexpr void unreach() noexcept {
+			distances.dependent set<Region>(unreached_value);
+			sentinel = unreached_value;
+		}
 
-			for (crauto goal : goals) {
-				if (!zone.dependent within<Region>(goal.position) || zone[goal.position] != value) {
-					continue;
-				}
+		// writes the step ascend or descend would take out of every cell, with ties met in the same order and unseated by a stable hash in place of a generator
+		template<zone_region_e Region, bool Descending, bool Unseating, typename Blocked>
+		constexpr void bake(ref<flow_map_t<ZoneSize>> flow, cref<Blocked> blocked, u32 seed, f64 unseat_probability) const noexcept {
+			for (offset_t::scalar_t y{ 0 }; y < ZoneSize.h; ++y) {
+				for (offset_t::scalar_t x{ 0 }; x < ZoneSize.w; ++x) {
+					const offset_t position{ x, y };
 
-				frontier.emplace(goal.position, goal.value);
+					if (!distances.dependent within<Region>(position) || (Descending && goal_reached(position))) {
+						flow[position] = cardinal_e::Central;
+						continue;
+					}
 
-				if (goal.value < 0) {
-					negative_goal = true;
-				}
-			}
+					offset_t best{ position };
+					D best_distance{ Descending ? sentinel : goal_value };
 
-			if (frontier.empty()) {
-				return *this;
-			}
+					u32 index{ 0 };
 
-			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.front() };
-				frontier.pop();
+					for (cauto offset : neighbourhood_offsets<DistanceFunction>) {
+						const offset_t offset_position{ position + offset };
 
-				visited.insert(current.position);
+						++index;
 
-				distances[current.position] = current.distance;
+						if (!distances.dependent within<Region>(offset_position)) {
+							continue;
+						}
 
-				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					cauto offset_position{ current.position + creeper.position };
+						const D offset_distance{ distances[offset_position] };
 
-					if (!visited.insert(offset_position).second || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value) {
-						continue;
+						if constexpr (Descending) {
+							if (Unseating ? offset_distance > best_distance : offset_distance >= best_distance) {
+								continue;
+							}
+						} else {
+							if (offset_distance == sentinel || (Unseating ? offset_distance < best_distance : offset_distance <= best_distance)) {
+								continue;
+							}
+						}
+
+						if (blocked(offset_position)) {
+							continue;
+						}
+
+						if constexpr (Unseating) {
+							if (offset_distance == best_distance && !flow_map_t<ZoneSize>::unseats(seed, position, index - 1, unseat_probability)) {
+								continue;
+							}
+						}
+
+						best = offset_position;
+						best_distance = offset_distance;
 					}
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
+					flow[position] = static_cast<cardinal_t>(best - position).value;
 				}
 			}
-
-			if (negative_goal) {
-				homogenize();
-			}
-
-			return *this;
 		}
 
-		template<zone_region_e Region, typename T, SparseBlockage Blockage> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value, cref<Blockage> blockage) noexcept {
-			clear();
+		constexpr bool reached(offset_t position) const noexcept { return distances[position] < sentinel; }
 
-			if (goals.empty()) {
-				return *this;
-			}
+		// lowest distance position can take from the reached cells around it
+		template<zone_region_e Region> constexpr D settle(offset_t position) const noexcept {
+			D best{ obstacle_value };
 
-			std::queue<creeper_t<D>> frontier{};
-			std::unordered_set<offset_t, offset_t::std_hasher> visited{};
+			for (crauto creeper : neighbourhood_creepers<DistanceFunction, D, FixedPoint>) {
+				const offset_t neighbour{ position + creeper.position };
 
-			bool negative_goal{ false };
-
-			for (crauto goal : goals) {
-				if (!zone.dependent within<Region>(goal.position) || zone[goal.position] != value) {
+				if (!distances.dependent within<Region>(neighbour) || !reached(neighbour)) {
 					continue;
 				}
 
-				frontier.emplace(goal.position, goal.value);
+				best = min<D>(best, D{ distances[neighbour] + creeper.distance });
+			}
 
-				if (goal.value < 0) {
-					negative_goal = true;
+			return best;
+		}
+
+		// repairs the distances after the cells in raised may have lost their support and the cells in lowered may offer a shorter one
+		// the raise wave invalidates every cell whose distance could have been derived through a raised cell, following only neighbours exactly one step further out
+		// the lower wave then settles the invalidated cells and the lowered ones from the valid cells around them and propagates in order of distance
+		template<zone_region_e Region, typename T, typename U, typename Blocked>
+		constexpr void repair(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<Blocked> blocked, std::initializer_list<offset_t> raised, std::initializer_list<offset_t> lowered) noexcept {
+			const auto open{ [&](offset_t position) -> bool { return zone.dependent within<Region>(position) && zone[position] == value && !blocked(position); } };
+
+			visited.reset();
+			frontier.clear();
+			queue.clear();
+			affected.clear();
+
+			for (offset_t position : raised) {
+				if (!distances.dependent within<Region>(position) || visited[position] || !reached(position)) {
+					continue;
 				}
-			}
 
-			if (frontier.empty()) {
-				return *this;
+				visited[position] = true;
+				frontier.push(position);
 			}
 
 			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.front() };
-				frontier.pop();
-
-				visited.insert(current.position);
+				const offset_t current{ frontier.pop() };
+				const D current_distance{ distances[current] };
 
-				distances[current.position] = current.distance;
+				distances[current] = obstacle_value;
+				affected.push_back(current);
 
-				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					cauto offset_position{ current.position + creeper.position };
+				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D, FixedPoint>) {
+					const offset_t offset_position{ current + creeper.position };
 
-					if (!visited.insert(offset_position).second || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value || blockage.contains(offset_position)) {
+					if (!distances.dependent within<Region>(offset_position) || visited[offset_position] || !reached(offset_position) || distances[offset_position] != D{ current_distance + creeper.distance }) {
 						continue;
 					}
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
+					visited[offset_position] = true;
+					frontier.push(offset_position);
 				}
 			}
 
-			if (negative_goal) {
-				homogenize();
-			}
+			const auto lower{ [&](offset_t position) {
+				if (!zone.dependent within<Region>(position) || zone[position] != value) {
+					return;
+				}
 
-			return *this;
-		}
+				// as in recalculate, goals are seeded even where blocked, while blocked cells cannot be entered from their neighbours
+				cptr<goal_t<D>> goal{ goals[position] };
 
-		template<zone_region_e Region, typename T, typename U, SparseBlockage Blockage>
-			requires is_equatable<T, U>::value
-		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<Blockage> sparse_blockage) noexcept {
-			clear<Region>();
+				D best{ goal != nullptr ? goal->value : obstacle_value };
 
-			if (goals.empty()) {
-				return *this;
+				if (!blocked(position)) {
+					best = min<D>(best, settle<Region>(position));
+				}
+
+				if (best >= distances[position]) {
+					return;
+				}
+
+				distances[position] = best;
+				queue.push(radix_key(best), position);
+			} };
+
+			for (offset_t position : affected) {
+				lower(position);
 			}
 
-			std::priority_queue<creeper_t<D>, std::vector<creeper_t<D>>, typename creeper_t<D>::less> frontier{};
-			std::unordered_set<offset_t, offset_t::std_hasher> visited{};
+			for (offset_t position : lowered) {
+				lower(position);
+			}
 
-			bool negative_goal{ false };
+			while (!queue.empty()) {
+				const auto [key, current] = queue.pop();
 
-			for (crauto goal : goals) {
-				if (!zone.dependent within<Region>(goal.position) || zone[goal.position] != value) {
+				// entries superseded by a shorter distance are skipped rather than removed
+				if (key != radix_key(distances[current])) {
 					continue;
 				}
 
-				frontier.emplace(goal.position, goal.value);
+				const D current_distance{ distances[current] };
+
+				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D, FixedPoint>) {
+					const offset_t offset_position{ current + creeper.position };
+
+					if (!open(offset_position)) {
+						continue;
+					}
 
+					const D offset_distance{ current_distance + creeper.distance };
+
+					if (offset_distance >= distances[offset_position]) {
+						continue;
+					}
+
+					distances[offset_position] = offset_distance;
+					queue.push(radix_key(offset_distance), offset_position);
+				}
+			}
+		}
+
+		// negative goals are folded by homogenize after propagation, which a repair cannot undo, so those fields are recalculated in full
+		constexpr bool repairable() const noexcept {
+			for (crauto goal : goals) {
 				if (goal.value < 0) {
-					negative_goal = true;
+					return false;
 				}
 			}
 
-			if (frontier.empty()) {
-				return *this;
+			return true;
+		}
+
+		// a field last solved across costs holds no unit-step distances to repair, so it is recalculated in full as well
+		template<zone_region_e Region, typename T, typename U, typename Blocked>
+		constexpr void repair_or_recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<Blocked> blocked, std::initializer_list<offset_t> raised, std::initializer_list<offset_t> lowered) noexcept {
+			if (sentinel == obstacle_value && repairable()) {
+				repair<Region>(zone, value, blocked, raised, lowered);
+			} else {
+				propagate<Region>(zone, value, blocked);
 			}
+		}
 
-			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.top() };
-				frontier.pop();
+	  public:
+		template<zone_region_e Region, typename T> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, FixedPoint>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value) noexcept {
+			return propagate<Region>(zone, value, [](offset_t) { return false; });
+		}
 
-				visited.insert(current.position);
+		template<zone_region_e Region, typename T, typename U>
+			requires is_equatable<T, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, FixedPoint>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value) noexcept {
+			return propagate<Region>(zone, value, [](offset_t) { return false; });
+		}
 
-				distances[current.position] = current.distance;
+		template<zone_region_e Region, typename T, SparseBlockage Blockage> constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, FixedPoint>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value, cref<Blockage> blockage) noexcept {
+			return propagate<Region>(zone, value, [&](offset_t position) { return blockage.contains(position); });
+		}
+
+		template<zone_region_e Region, typename T, typename U, SparseBlockage Blockage>
+			requires is_equatable<T, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, FixedPoint>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<Blockage> sparse_blockage) noexcept {
+			return propagate<Region>(zone, value, [&](offset_t position) { return sparse_blockage.contains(position); });
+		}
 
-				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					cauto offset_position{ current.position + creeper.position };
+		template<zone_region_e Region, typename T, SparseBlockage... Blockages>
+			requires is_plurary<Blockages...>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, FixedPoint>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value, cref<Blockages>... blockages) noexcept {
+			return propagate<Region>(zone, value, [&](offset_t position) { return (blockages.contains(position) || ...); });
+		}
 
-					if (!visited.insert(offset_position).second || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value || sparse_blockage.contains(offset_position)) {
-						continue;
-					}
+		template<zone_region_e Region, typename T, typename U, SparseBlockage... Blockages>
+			requires is_plurary<Blockages...>::value && is_equatable<T, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, FixedPoint>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<Blockages>... blockages) noexcept {
+			return propagate<Region>(zone, value, [&](offset_t position) { return (blockages.contains(position) || ...); });
+		}
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
-				}
-			}
+		// recalculates and bakes the flow in the same pass, each cell pointing back along the step by which its distance was measured and thereby along a shortest path to the goals
+		// under unit steps that is a lowest neighbour as descend would take, though ties are settled by whichever neighbour reached the cell first
+		// negative goals fold the distances once propagation ends, so those fields are baked afterwards as descent would bake them
+		template<zone_region_e Region, typename T, typename U, SparseBlockage... Blockages>
+			requires is_equatable<T, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, FixedPoint>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, ref<flow_map_t<ZoneSize>> flow, cref<Blockages>... blockages) noexcept {
+			flow.clear();
 
-			if (negative_goal) {
-				homogenize();
+			propagate<Region>(zone, value, [&](offset_t cell) { return (blockages.contains(cell) || ...); }, [&](offset_t cell, offset_t towards) { flow[cell] = static_cast<cardinal_t>(towards).value; });
+
+			if (!repairable()) {
+				descent<Region>(flow, blockages...);
 			}
 
 			return *this;
 		}
 
-		template<zone_region_e Region, typename T, SparseBlockage... Blockages>
-			requires is_plurary<Blockages...>::value
-		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<T> value, cref<Blockages>... blockages) noexcept {
-			clear();
+		// the following measure distances across terrain of varying cost; entering a cell costs the step to it scaled by the cost of the cell
+		// cells costing nothing or less are impassable, and the cells no path reaches are left at unreached_value, to which path lengths saturate rather than overflow
+		// both solvers yield exact shortest distances, and therefore equal distances for the same costs and goals
+
+		// settles cells in order of distance through the radix heap, visiting each reachable cell once
+		template<zone_region_e Region, Numeric C, SparseBlockage... Blockages>
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, FixedPoint>> traverse(cref<zone_t<C, ZoneSize, ZoneBorder>> costs, cref<Blockages>... blockages) noexcept {
+			unreach<Region>();
 
 			if (goals.empty()) {
 				return *this;
 			}
 
-			std::queue<creeper_t<D>> frontier{};
-			std::unordered_set<offset_t, offset_t::std_hasher> visited{};
+			visited.reset();
+			queue.clear();
 
 			bool negative_goal{ false };
 
 			for (crauto goal : goals) {
-				if (!zone.dependent within<Region>(goal.position) || zone[goal.position] != value) {
+				if (!costs.dependent within<Region>(goal.position) || costs[goal.position] <= C{ 0 } || goal.value >= distances[goal.position]) {
 					continue;
 				}
 
-				frontier.emplace(goal.position, goal.value);
-
 				if (goal.value < 0) {
 					negative_goal = true;
 				}
-			}
 
-			if (frontier.empty()) {
-				return *this;
+				distances[goal.position] = goal.value;
+				queue.push(radix_key(goal.value), goal.position);
 			}
 
-			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.front() };
-				frontier.pop();
+			while (!queue.empty()) {
+				const offset_t current{ queue.pop().second };
+
+				if (visited[current]) {
+					continue;
+				}
 
-				visited.insert(current.position);
+				visited[current] = true;
 
-				distances[current.position] = current.distance;
+				const D current_distance{ distances[current] };
+
+				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D, FixedPoint>) {
+					const offset_t offset_position{ current + creeper.position };
+
+					if (!costs.dependent within<Region>(offset_position) || visited[offset_position] || costs[offset_position] <= C{ 0 } || (blockages.contains(offset_position) || ...)) {
+						continue;
+					}
 
-				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					cauto offset_position{ current.position + creeper.position };
+					const D offset_distance{ accrue(current_distance, toll(creeper.distance, costs[offset_position])) };
 
-					if (!visited.insert(offset_position).second || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value || (blockages.contains(offset_position) || ...)) {
+					if (offset_distance >= distances[offset_position]) {
 						continue;
 					}
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
+					distances[offset_position] = offset_distance;
+					queue.push(radix_key(offset_distance), offset_position);
 				}
 			}
 
@@ -369,52 +560,109 @@ namespace bleak {
 			return *this;
 		}
 
-		template<zone_region_e Region, typename T, typename U, SparseBlockage... Blockages>
-			requires is_plurary<Blockages...>::value && is_equatable<T, U>::value
-		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder>> recalculate(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, cref<Blockages>... blockages) noexcept {
-			clear<Region>();
+		// fast sweeping with the neighbourhood as a 3x3 chamfer mask; each pass takes every row from the row behind it in a branch-free step across the whole row before sweeping along it
+		// passes alternate direction until one pair of them changes nothing, which for open terrain is the first pair and otherwise grows with how often paths wind back on themselves
+		// blockages are not consulted cell by cell here, so the cells they hold should be given no cost instead
+		template<zone_region_e Region, Numeric C>
+			requires(Region == zone_region_e::All || Region == zone_region_e::Interior)
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, FixedPoint>> sweep(cref<zone_t<C, ZoneSize, ZoneBorder>> costs) noexcept {
+			using zone_type = zone_t<D, ZoneSize, ZoneBorder>;
+
+			constexpr offset_t::scalar_t left{ Region == zone_region_e::All ? 0 : zone_type::interior_origin.x };
+			constexpr offset_t::scalar_t right{ Region == zone_region_e::All ? zone_type::zone_extent.x : zone_type::interior_extent.x };
+			constexpr offset_t::scalar_t top{ Region == zone_region_e::All ? 0 : zone_type::interior_origin.y };
+			constexpr offset_t::scalar_t bottom{ Region == zone_region_e::All ? zone_type::zone_extent.y : zone_type::interior_extent.y };
+
+			constexpr D Orthogonal{ neighbourhood_creepers<DistanceFunction, D, FixedPoint>[0].distance };
+			constexpr bool Diagonals{ neighbourhood_creepers<DistanceFunction, D, FixedPoint>.size() == 8 };
+
+			unreach<Region>();
 
 			if (goals.empty()) {
 				return *this;
 			}
 
-			std::priority_queue<creeper_t<D>, std::vector<creeper_t<D>>, typename creeper_t<D>::less> frontier{};
-			std::unordered_set<offset_t, offset_t::std_hasher> visited{};
-
 			bool negative_goal{ false };
 
 			for (crauto goal : goals) {
-				if (!zone.dependent within<Region>(goal.position) || zone[goal.position] != value) {
+				if (!costs.dependent within<Region>(goal.position) || costs[goal.position] <= C{ 0 } || goal.value >= distances[goal.position]) {
 					continue;
 				}
 
-				frontier.emplace(goal.position, goal.value);
-
 				if (goal.value < 0) {
 					negative_goal = true;
 				}
-			}
 
-			if (frontier.empty()) {
-				return *this;
+				distances[goal.position] = goal.value;
 			}
 
-			while (!frontier.empty()) {
-				const creeper_t<D> current{ frontier.top() };
-				frontier.pop();
+			// reads go through a constant view so the row steps are free of the dirty tracking done by writes
+			cref<zone_type> measured{ distances };
 
-				visited.insert(current.position);
+			// takes row y from row y - direction, then sweeps along it both ways as paths may run either way within the row
+			const auto relax{ [&](offset_t::scalar_t y, offset_t::scalar_t direction) -> bool {
+				bool changed{ false };
 
-				distances[current.position] = current.distance;
+				if (y - direction >= top && y - direction <= bottom) {
+					const offset_t::scalar_t behind{ y - direction };
 
-				for (crauto creeper : neighbourhood_creepers<DistanceFunction, D>) {
-					cauto offset_position{ current.position + creeper.position };
+					for (offset_t::scalar_t x{ left }; x <= right; ++x) {
+						const C cost{ costs[x, y] };
 
-					if (!visited.insert(offset_position).second || !zone.dependent within<Region>(offset_position) || zone[offset_position] != value || (blockages.contains(offset_position) || ...)) {
-						continue;
+						D candidate{ accrue(measured[x, behind], toll(Orthogonal, cost)) };
+
+						if constexpr (Diagonals) {
+							constexpr D Diagonal{ neighbourhood_creepers<DistanceFunction, D, FixedPoint>.back().distance };
+
+							if (x > left) {
+								candidate = min<D>(candidate, accrue(measured[x - 1, behind], toll(Diagonal, cost)));
+							}
+
+							if (x < right) {
+								candidate = min<D>(candidate, accrue(measured[x + 1, behind], toll(Diagonal, cost)));
+							}
+						}
+
+						const D previous{ measured[x, y] };
+						const D next{ cost > C{ 0 } && candidate < previous ? candidate : previous };
+
+						changed |= next != previous;
+						distances[x, y] = next;
 					}
+				}
+
+				for (offset_t::scalar_t x{ left + 1 }; x <= right; ++x) {
+					const C cost{ costs[x, y] };
+					const D candidate{ accrue(measured[x - 1, y], toll(Orthogonal, cost)) };
+
+					if (cost > C{ 0 } && candidate < measured[x, y]) {
+						distances[x, y] = candidate;
+						changed = true;
+					}
+				}
+
+				for (offset_t::scalar_t x{ right - 1 }; x >= left; --x) {
+					const C cost{ costs[x, y] };
+					const D candidate{ accrue(measured[x + 1, y], toll(Orthogonal, cost)) };
+
+					if (cost > C{ 0 } && candidate < measured[x, y]) {
+						distances[x, y] = candidate;
+						changed = true;
+					}
+				}
+
+				return changed;
+			} };
 
-					frontier.emplace(offset_position, D{ current.distance + creeper.distance });
+			for (bool changed{ true }; changed;) {
+				changed = false;
+
+				for (offset_t::scalar_t y{ top }; y <= bottom; ++y) {
+					changed |= relax(y, 1);
+				}
+
+				for (offset_t::scalar_t y{ bottom }; y >= top; --y) {
+					changed |= relax(y, -1);
 				}
 			}
 
@@ -437,7 +685,7 @@ namespace bleak {
 				const offset_t offset_position{ position + offset };
 				const D offset_distance{ distances[offset_position] };
 
-				if (!distances.dependent within<Region>(offset_position) || offset_distance == obstacle_value || offset_distance <= highest_distance) {
+				if (!distances.dependent within<Region>(offset_position) || offset_distance == sentinel || offset_distance <= highest_distance) {
 					continue;
 				}
 
@@ -464,7 +712,7 @@ namespace bleak {
 				const offset_t offset_position{ position + offset };
 				const D offset_distance{ distances[offset_position] };
 
-				if (!distances.dependent within<Region>(offset_position) || offset_distance == obstacle_value || offset_distance <= highest_distance || sparse_blockage.contains(offset_position)) {
+				if (!distances.dependent within<Region>(offset_position) || offset_distance == sentinel || offset_distance <= highest_distance || sparse_blockage.contains(offset_position)) {
 					continue;
 				}
 
@@ -493,7 +741,7 @@ namespace bleak {
 				const offset_t offset_position{ position + offset };
 				const D offset_distance{ distances[offset_position] };
 
-				if (!distances.dependent within<Region>(offset_position) || offset_distance == obstacle_value || offset_distance < highest_distance || (offset_distance == highest_distance && !distribution(generator))) {
+				if (!distances.dependent within<Region>(offset_position) || offset_distance == sentinel || offset_distance < highest_distance || (offset_distance == highest_distance && !distribution(generator))) {
 					continue;
 				}
 
@@ -522,7 +770,7 @@ namespace bleak {
 				const offset_t offset_position{ position + offset };
 				const D offset_distance{ distances[offset_position] };
 
-				if (!distances.dependent within<Region>(offset_position) || offset_distance == obstacle_value || offset_distance < highest_distance || sparse_blockage.contains(offset_position) || (offset_distance == highest_distance && !distribution(generator))) {
+				if (!distances.dependent within<Region>(offset_position) || offset_distance == sentinel || offset_distance < highest_distance || sparse_blockage.contains(offset_position) || (offset_distance == highest_distance && !distribution(generator))) {
 					continue;
 				}
 
@@ -543,7 +791,7 @@ namespace bleak {
 			}
 
 			offset_t lowest{ position };
-			D lowest_distance{ obstacle_value };
+			D lowest_distance{ sentinel };
 
 			for (cauto offset : neighbourhood_offsets<DistanceFunction>) {
 				const offset_t offset_position{ position + offset };
@@ -570,7 +818,7 @@ namespace bleak {
 			}
 
 			offset_t lowest{ position };
-			D lowest_distance{ obstacle_value };
+			D lowest_distance{ sentinel };
 
 			for (cauto offset : neighbourhood_offsets<DistanceFunction>) {
 				const offset_t offset_position{ position + offset };
@@ -599,7 +847,7 @@ namespace bleak {
 			std::bernoulli_distribution distribution{ unseat_probability };
 
 			offset_t lowest{ position };
-			D lowest_distance{ obstacle_value };
+			D lowest_distance{ sentinel };
 
 			for (cauto offset : neighbourhood_offsets<DistanceFunction>) {
 				const offset_t offset_position{ position + offset };
@@ -628,7 +876,7 @@ namespace bleak {
 			std::bernoulli_distribution distribution{ unseat_probability };
 
 			offset_t lowest{ position };
-			D lowest_distance{ obstacle_value };
+			D lowest_distance{ sentinel };
 
 			for (cauto offset : neighbourhood_offsets<DistanceFunction>) {
 				const offset_t offset_position{ position + offset };
@@ -649,6 +897,25 @@ namespace bleak {
 			return lowest;
 		}
 
+		// the following bake the step ascend or descend would take from every cell into a flow map, so that following the field costs a lookup per step
+		// the unseating bakes stand a stable hash of seed and cell in for the generator; a bake settles every tie the same way until it is given another seed
+
+		template<zone_region_e Region, SparseBlockage... Blockages> constexpr void descent(ref<flow_map_t<ZoneSize>> flow, cref<Blockages>... blockages) const noexcept {
+			bake<Region, true, false>(flow, [&](offset_t cell) { return (blockages.contains(cell) || ...); }, 0, 0.0);
+		}
+
+		template<zone_region_e Region, SparseBlockage... Blockages> constexpr void descent(ref<flow_map_t<ZoneSize>> flow, u32 seed, f64 unseat_probability, cref<Blockages>... blockages) const noexcept {
+			bake<Region, true, true>(flow, [&](offset_t cell) { return (blockages.contains(cell) || ...); }, seed, unseat_probability);
+		}
+
+		template<zone_region_e Region, SparseBlockage... Blockages> constexpr void ascent(ref<flow_map_t<ZoneSize>> flow, cref<Blockages>... blockages) const noexcept {
+			bake<Region, false, false>(flow, [&](offset_t cell) { return (blockages.contains(cell) || ...); }, 0, 0.0);
+		}
+
+		template<zone_region_e Region, SparseBlockage... Blockages> constexpr void ascent(ref<flow_map_t<ZoneSize>> flow, u32 seed, f64 unseat_probability, cref<Blockages>... blockages) const noexcept {
+			bake<Region, false, true>(flow, [&](offset_t cell) { return (blockages.contains(cell) || ...); }, seed, unseat_probability);
+		}
+
 		template<zone_region_e Region, typename Randomizer, typename T, SparseBlockage Blockage>
 		constexpr std::optional<offset_t> find_random(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, ref<Randomizer> generator, cref<T> value, cref<Blockage> sparse_blockage, cref<D> minimum_distance) const noexcept {
 			if constexpr (Region == zone_region_e::None) {
@@ -888,7 +1155,7 @@ namespace bleak {
 				return false;
 			}
 
-			return goals.add(goal_t<D>{ goal, goal_value });
+			return goals.add(goal_t<D>{ goal_value, goal });
 		}
 
 		constexpr bool add(offset_t goal, D value) noexcept {
@@ -904,7 +1171,7 @@ namespace bleak {
 				return false;
 			}
 
-			return goals.add(goal_t<D>{ goal, value });
+			return goals.add(goal_t<D>{ value, goal });
 		}
 
 		constexpr bool remove(offset_t goal) noexcept {
@@ -938,5 +1205,53 @@ namespace bleak {
 
 			return goals.move(from, to);
 		}
+
+		// the following edit the goals or follow an edit of the zone and then repair only the distances the change affects
+		// distances are repaired to exact shortest distances, which is what recalculate yields for the same zone, value and blockages whatever the values of the goals
+
+		// call after zone[position] changes or a blockage gains or loses position
+		template<zone_region_e Region, typename T, typename U, SparseBlockage... Blockages>
+			requires is_equatable<T, U>::value
+		constexpr ref<field_t<D, DistanceFunction, ZoneSize, ZoneBorder, FixedPoint>> repair(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, offset_t position, cref<Blockages>... blockages) noexcept {
+			repair_or_recalculate<Region>(zone, value, [&](offset_t cell) { return (blockages.contains(cell) || ...); }, { position }, { position });
+
+			return *this;
+		}
+
+		template<zone_region_e Region, typename T, typename U, SparseBlockage... Blockages>
+			requires is_equatable<T, U>::value
+		constexpr bool add(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, offset_t goal, cref<Blockages>... blockages) noexcept {
+			if (!add<Region>(goal)) {
+				return false;
+			}
+
+			repair_or_recalculate<Region>(zone, value, [&](offset_t cell) { return (blockages.contains(cell) || ...); }, {}, { goal });
+
+			return true;
+		}
+
+		template<zone_region_e Region, typename T, typename U, SparseBlockage... Blockages>
+			requires is_equatable<T, U>::value
+		constexpr bool remove(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, offset_t goal, cref<Blockages>... blockages) noexcept {
+			if (!remove<Region>(goal)) {
+				return false;
+			}
+
+			repair_or_recalculate<Region>(zone, value, [&](offset_t cell) { return (blockages.contains(cell) || ...); }, { goal }, {});
+
+			return true;
+		}
+
+		template<zone_region_e Region, typename T, typename U, SparseBlockage... Blockages>
+			requires is_equatable<T, U>::value
+		constexpr bool update(cref<zone_t<T, ZoneSize, ZoneBorder>> zone, cref<U> value, offset_t from, offset_t to, cref<Blockages>... blockages) noexcept {
+			if (!update<Region>(from, to)) {
+				return false;
+			}
+
+			repair_or_recalculate<Region>(zone, value, [&](offset_t cell) { return (blockages.contains(cell) || ...); }, { from }, { to });
+
+			return true;
+		}
 	};
 } // namespace bleak
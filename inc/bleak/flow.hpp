@@ -0,0 +1,60 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <optional>
+
+#include <bleak/array.hpp>
+#include <bleak/cardinal.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+
+namespace bleak {
+	// the direction of the best step out of every cell of a field, baked once so that agents following the field look their step up rather than searching for it
+	// each direction is a cardinal of four bits held in a byte of its own, so bakes may write cells independently; cells with nowhere to go hold central
+	template<extent_t Size> struct flow_map_t {
+	  private:
+		array_t<cardinal_e, Size> directions;
+
+	  public:
+		inline flow_map_t() noexcept : directions{} { clear(); }
+
+		constexpr void clear() noexcept { std::fill(directions.begin(), directions.end(), cardinal_e::Central); }
+
+		constexpr cardinal_e operator[](offset_t position) const noexcept { return directions[position]; }
+
+		constexpr cardinal_e operator[](extent_t::scalar_t x, extent_t::scalar_t y) const noexcept { return directions[x, y]; }
+
+		constexpr ref<cardinal_e> operator[](offset_t position) noexcept { return directions[position]; }
+
+		constexpr ref<cardinal_e> operator[](extent_t::scalar_t x, extent_t::scalar_t y) noexcept { return directions[x, y]; }
+
+		constexpr cref<array_t<cardinal_e, Size>> data() const noexcept { return directions; }
+
+		// the cell a step out of position leads to, or nothing when position holds central
+		constexpr std::optional<offset_t> step(offset_t position) const noexcept {
+			const cardinal_e direction{ directions[position] };
+
+			if (direction == cardinal_e::Central) {
+				return std::nullopt;
+			}
+
+			return position + offset_t{ cardinal_t{ direction } };
+		}
+
+		// whether a tie met at the index-th neighbour of position unseats the step chosen so far; a hash of the seed, position and index stands in for a generator,
+		// so a bake decides every tie the same way until the seed changes, and is free to visit cells in any order
+		static constexpr bool unseats(u32 seed, offset_t position, u32 index, f64 unseat_probability) noexcept {
+			u32 state{ seed ^ (static_cast<u32>(position.x) * 0x27D4EB2Du) ^ (static_cast<u32>(position.y) * 0x165667B1u) ^ (index * 0x9E3779B9u) };
+
+			state ^= state >> 16;
+			state *= 0x85EBCA6Bu;
+			state ^= state >> 13;
+			state *= 0xC2B2AE35u;
+			state ^= state >> 16;
+
+			return static_cast<f64>(state) < unseat_probability * 4294967296.0;
+		}
+	};
+} // namespace bleak
@@ -0,0 +1,250 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <mutex>
+#include <vector>
+
+#include <bleak/array.hpp>
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/rect.hpp>
+#include <bleak/thread_pool.hpp>
+#include <bleak/utility.hpp>
+#include <bleak/zone.hpp>
+
+namespace bleak {
+	// statistics of one connected component as gathered while labeling
+	struct component_t {
+		offset_t origin;
+		offset_t extent;
+
+		usize size;
+
+		constexpr rect_t bounds() const noexcept { return rect_t{ origin, extent_t{ extent.x - origin.x + 1, extent.y - origin.y + 1 } }; }
+	};
+
+	// dense connected component labels of the cells of a zone equal to a value, found in two raster passes over a union-find forest
+	// labels run from one to count() in the order their first cell is met in raster order; all other cells are labeled background
+	// the label array, forest and component list are kept between calls so relabeling a zone of the same size does not allocate
+	template<extent_t Size> struct label_map_t {
+		static_assert(static_cast<u64>(Size.area()) < (u64{ 1 } << 32), "zone is too large to label with 32-bit indices!");
+
+		static constexpr u32 background{ 0 };
+
+	  private:
+		array_t<u32, Size> labels;
+
+		// parent of every cell by raster index; each root is the lowest index of its tree, and thereby the first cell of its component
+		std::vector<u32> parents;
+
+		std::vector<component_t> components;
+
+		static constexpr u32 index_of(extent_t::scalar_t x, extent_t::scalar_t y) noexcept { return static_cast<u32>(y) * static_cast<u32>(Size.w) + static_cast<u32>(x); }
+
+		constexpr u32 find(u32 index) noexcept {
+			// path halving
+			while (parents[index] != index) {
+				parents[index] = parents[parents[index]];
+				index = parents[index];
+			}
+
+			return index;
+		}
+
+		constexpr void unite(u32 lhs, u32 rhs) noexcept {
+			lhs = find(lhs);
+			rhs = find(rhs);
+
+			if (lhs < rhs) {
+				parents[rhs] = lhs;
+			} else if (rhs < lhs) {
+				parents[lhs] = rhs;
+			}
+		}
+
+		// the first neighbour a cell meets can adopt it outright, as the cell is still a root of its own
+		constexpr void link(u32 index, u32 neighbour) noexcept {
+			if (parents[index] == index) {
+				parents[index] = find(neighbour);
+			} else {
+				unite(index, neighbour);
+			}
+		}
+
+		constexpr bool marked(extent_t::scalar_t x, extent_t::scalar_t y) const noexcept { return labels[x, y] != background; }
+
+		// first pass over rows [first_row, last_row); cells are only joined to neighbours within those rows, so bands touch disjoint parts of the forest
+		template<solver_e Solver, typename T, extent_t BorderSize, typename U> constexpr void scan(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value, extent_t::scalar_t first_row, extent_t::scalar_t last_row) noexcept {
+			for (extent_t::scalar_t y{ first_row }; y < last_row; ++y) {
+				const bool has_north{ y > first_row };
+
+				for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+					if (zone[x, y] != value) {
+						labels[x, y] = background;
+						continue;
+					}
+
+					const u32 index{ index_of(x, y) };
+
+					labels[x, y] = index + 1;
+					parents[index] = index;
+
+					if constexpr (Solver == solver_e::Moore) {
+						// the north cell touches every other neighbour already visited, so it alone suffices when present
+						if (has_north && marked(x, y - 1)) {
+							link(index, index - Size.w);
+							continue;
+						}
+
+						if (x > 0 && marked(x - 1, y)) {
+							link(index, index - 1);
+						} else if (has_north && x > 0 && marked(x - 1, y - 1)) {
+							link(index, index - Size.w - 1);
+						}
+
+						if (has_north && x < Size.w - 1 && marked(x + 1, y - 1)) {
+							link(index, index - Size.w + 1);
+						}
+					} else {
+						if (has_north && marked(x, y - 1)) {
+							link(index, index - Size.w);
+						}
+
+						if (x > 0 && marked(x - 1, y)) {
+							link(index, index - 1);
+						}
+					}
+				}
+			}
+		}
+
+		// joins the components of row y to those of the row above it where a band boundary kept them apart
+		template<solver_e Solver> constexpr void stitch(extent_t::scalar_t y) noexcept {
+			for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+				if (!marked(x, y)) {
+					continue;
+				}
+
+				const u32 index{ index_of(x, y) };
+
+				if (marked(x, y - 1)) {
+					unite(index, index - Size.w);
+				}
+
+				if constexpr (Solver == solver_e::Moore) {
+					if (x > 0 && marked(x - 1, y - 1)) {
+						unite(index, index - Size.w - 1);
+					}
+
+					if (x < Size.w - 1 && marked(x + 1, y - 1)) {
+						unite(index, index - Size.w + 1);
+					}
+				}
+			}
+		}
+
+		// second pass; roots precede the rest of their component in raster order, so each cell can copy the final label of its root
+		constexpr void resolve() noexcept {
+			components.clear();
+
+			for (extent_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+					if (!marked(x, y)) {
+						continue;
+					}
+
+					const u32 index{ index_of(x, y) };
+					const u32 root{ find(index) };
+
+					if (root == index) {
+						components.push_back(component_t{ offset_t{ x, y }, offset_t{ x, y }, 0 });
+
+						labels[x, y] = static_cast<u32>(components.size());
+					} else {
+						labels[x, y] = labels[static_cast<extent_t::scalar_t>(root % Size.w), static_cast<extent_t::scalar_t>(root / Size.w)];
+					}
+
+					ref<component_t> component{ components[labels[x, y] - 1] };
+
+					++component.size;
+
+					component.origin.x = min<offset_t::scalar_t>(component.origin.x, x);
+					component.extent.x = max<offset_t::scalar_t>(component.extent.x, x);
+					component.extent.y = y;
+				}
+			}
+		}
+
+	  public:
+		inline label_map_t() noexcept : labels{}, parents(static_cast<usize>(Size.area())), components{} {}
+
+		constexpr u32 count() const noexcept { return static_cast<u32>(components.size()); }
+
+		constexpr bool empty() const noexcept { return components.empty(); }
+
+		constexpr u32 operator[](offset_t position) const noexcept { return labels[position]; }
+
+		constexpr u32 operator[](extent_t::scalar_t x, extent_t::scalar_t y) const noexcept { return labels[x, y]; }
+
+		constexpr cref<array_t<u32, Size>> data() const noexcept { return labels; }
+
+		// only meaningful for labels in [1, count()]
+		constexpr cref<component_t> component(u32 label) const noexcept { return components[label - 1]; }
+
+		constexpr cref<std::vector<component_t>> all() const noexcept { return components; }
+
+		// label of the component with the most cells, or background when there are none
+		constexpr u32 largest() const noexcept {
+			u32 largest{ background };
+			usize largest_size{ 0 };
+
+			for (usize i{ 0 }; i < components.size(); ++i) {
+				if (components[i].size > largest_size) {
+					largest = static_cast<u32>(i + 1);
+					largest_size = components[i].size;
+				}
+			}
+
+			return largest;
+		}
+
+		// moore connectivity joins diagonal neighbours as area_t::flood does, von neumann only orthogonal ones
+		template<solver_e Solver = solver_e::Moore, typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value && (Solver == solver_e::Moore || Solver == solver_e::VonNeumann)
+		constexpr ref<label_map_t<Size>> label(cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept {
+			scan<Solver>(zone, value, 0, Size.h);
+			resolve();
+
+			return *this;
+		}
+
+		// bands of rows are scanned concurrently and then stitched together along their boundaries
+		template<solver_e Solver = solver_e::Moore, typename T, extent_t BorderSize, typename U>
+			requires is_equatable<T, U>::value && (Solver == solver_e::Moore || Solver == solver_e::VonNeumann)
+		inline ref<label_map_t<Size>> label(ref<thread_pool_t> pool, cref<zone_t<T, Size, BorderSize>> zone, cref<U> value) noexcept {
+			std::vector<extent_t::scalar_t> seams{};
+
+			std::mutex access{};
+
+			pool.parallel_for(0, Size.h, [&](isize first_row, isize last_row) {
+				scan<Solver>(zone, value, static_cast<extent_t::scalar_t>(first_row), static_cast<extent_t::scalar_t>(last_row));
+
+				if (first_row > 0) {
+					std::lock_guard<std::mutex> lock{ access };
+
+					seams.push_back(static_cast<extent_t::scalar_t>(first_row));
+				}
+			});
+
+			for (extent_t::scalar_t seam : seams) {
+				stitch<Solver>(seam);
+			}
+
+			resolve();
+
+			return *this;
+		}
+	};
+} // namespace bleak
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <bit>
+
+#include <immintrin.h>
+
+#include <bleak/extent.hpp>
+#include <bleak/leaf.hpp>
+#include <bleak/offset.hpp>
+
+namespace bleak {
+	enum struct layout_e : u8 {
+		// rows stored one after another
+		RowMajor,
+		// z-order curve within square blocks of the shorter side, blocks stored along the longer side
+		Morton,
+		// 8x8 blocks stored row-major, cells row-major within each block
+		Tiled
+	};
+
+	// layout chosen by array_t when none is named; specialize to move a particular cell type or size onto a local layout
+	template<typename T, extent_t Size> struct layout_policy {
+		static constexpr layout_e value{ layout_e::RowMajor };
+	};
+
+	// maps positions to storage indices; every layout is dense so storage always holds exactly Size.area() elements
+	template<extent_t Size, layout_e Layout> struct layout_t {
+		static constexpr extent_t size{ Size };
+
+		static_assert(Layout != layout_e::Morton || (std::has_single_bit(static_cast<u32>(Size.w)) && std::has_single_bit(static_cast<u32>(Size.h))), "morton layout requires power of two extents!");
+		static_assert(Layout != layout_e::Tiled || (Size.w % 8 == 0 && Size.h % 8 == 0), "tiled layout requires extents divisible by the tile size!");
+
+		static constexpr extent_t::scalar_t tile_bits{ 3 };
+		static constexpr extent_t::scalar_t tile_mask{ (1 << tile_bits) - 1 };
+		static constexpr extent_t::scalar_t tiles_wide{ Size.w >> tile_bits };
+
+		// side length, as a power of two, of the square blocks each covered by a single z-order curve
+		static constexpr u32 block_bits{ Layout == layout_e::Morton ? static_cast<u32>(std::countr_zero(static_cast<u32>(Size.w < Size.h ? Size.w : Size.h))) : 0 };
+		static constexpr u32 block_mask{ (u32{ 1 } << block_bits) - 1 };
+
+		static constexpr usize flatten(offset_t::scalar_t x, offset_t::scalar_t y) noexcept {
+			if constexpr (Layout == layout_e::Morton) {
+				// one of the block coordinates is always zero since the shorter side fits within a single block
+				const usize block{ static_cast<usize>(static_cast<u32>(x) >> block_bits) + static_cast<usize>(static_cast<u32>(y) >> block_bits) };
+
+				return (block << (block_bits * 2)) | static_cast<usize>(interleave<u64>(static_cast<u32>(x) & block_mask, static_cast<u32>(y) & block_mask));
+			} else if constexpr (Layout == layout_e::Tiled) {
+				const usize tile{ static_cast<usize>(y >> tile_bits) * tiles_wide + static_cast<usize>(x >> tile_bits) };
+
+				return (tile << (tile_bits * 2)) | static_cast<usize>((y & tile_mask) << tile_bits) | static_cast<usize>(x & tile_mask);
+			} else {
+				return static_cast<usize>(y) * Size.w + x;
+			}
+		}
+
+		static constexpr usize flatten(offset_t position) noexcept { return flatten(position.x, position.y); }
+
+		static constexpr offset_t unflatten(usize index) noexcept {
+			if constexpr (Layout == layout_e::Morton) {
+				const u64 local{ static_cast<u64>(index & ((usize{ 1 } << (block_bits * 2)) - 1)) };
+				const usize block{ index >> (block_bits * 2) };
+
+				const offset_t::scalar_t local_x{ static_cast<offset_t::scalar_t>(_pext_u64(local, 0x5555'5555'5555'5555)) };
+				const offset_t::scalar_t local_y{ static_cast<offset_t::scalar_t>(_pext_u64(local, 0xAAAA'AAAA'AAAA'AAAA)) };
+
+				const offset_t::scalar_t block_offset{ static_cast<offset_t::scalar_t>(block << block_bits) };
+
+				return Size.w >= Size.h ? offset_t{ local_x + block_offset, local_y } : offset_t{ local_x, local_y + block_offset };
+			} else if constexpr (Layout == layout_e::Tiled) {
+				const usize tile{ index >> (tile_bits * 2) };
+				const usize local{ index & ((usize{ 1 } << (tile_bits * 2)) - 1) };
+
+				return offset_t{ static_cast<offset_t::scalar_t>((tile % tiles_wide) << tile_bits) + static_cast<offset_t::scalar_t>(local & tile_mask), static_cast<offset_t::scalar_t>((tile / tiles_wide) << tile_bits) + static_cast<offset_t::scalar_t>(local >> tile_bits) };
+			} else {
+				return offset_t{ static_cast<offset_t::scalar_t>(index % Size.w), static_cast<offset_t::scalar_t>(index / Size.w) };
+			}
+		}
+	};
+} // namespace bleak
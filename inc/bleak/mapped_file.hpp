@@ -0,0 +1,90 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <string>
+#include <utility>
+
+#include <bleak/log.hpp>
+
+namespace bleak {
+	namespace mapping {
+		enum struct status_e : u8 {
+			Mapped,
+			Unopenable,
+			Empty,
+			Unmappable
+		};
+
+		// defined in src/mapped_file.cpp so that platform headers stay out of the interface; handles are closed once mapped as the view keeps the file alive
+		extern status_e map(cref<std::string> path, ref<cstr> address, ref<usize> length) noexcept;
+
+		extern void unmap(cstr address, usize length) noexcept;
+	} // namespace mapping
+
+	// read-only mapping of an entire file; pages are faulted in on first access rather than read up front
+	struct mapped_file_t {
+	  private:
+		cstr address;
+		usize length;
+
+		inline void release() noexcept {
+			if (address != nullptr) {
+				mapping::unmap(address, length);
+			}
+
+			address = nullptr;
+			length = 0;
+		}
+
+	  public:
+		inline mapped_file_t() noexcept : address{ nullptr }, length{ 0 } {}
+
+		inline mapped_file_t(cref<std::string> path) noexcept : mapped_file_t{} {
+			switch (mapping::map(path, address, length)) {
+				case mapping::status_e::Mapped: {
+					return;
+				}
+				case mapping::status_e::Unopenable: {
+					error_log.add("failed to open \"{}\" for mapping!", path);
+					break;
+				}
+				case mapping::status_e::Empty: {
+					error_log.add("unable to map empty or unreadable file \"{}\"!", path);
+					break;
+				}
+				case mapping::status_e::Unmappable: {
+					error_log.add("failed to map \"{}\"!", path);
+					break;
+				}
+			}
+
+			address = nullptr;
+			length = 0;
+		}
+
+		inline mapped_file_t(cref<mapped_file_t> other) noexcept = delete;
+		inline ref<mapped_file_t> operator=(cref<mapped_file_t> other) noexcept = delete;
+
+		inline mapped_file_t(rval<mapped_file_t> other) noexcept : address{ std::exchange(other.address, nullptr) }, length{ std::exchange(other.length, 0) } {}
+
+		inline ref<mapped_file_t> operator=(rval<mapped_file_t> other) noexcept {
+			if (this != &other) {
+				release();
+
+				address = std::exchange(other.address, nullptr);
+				length = std::exchange(other.length, 0);
+			}
+
+			return *this;
+		}
+
+		inline ~mapped_file_t() noexcept { release(); }
+
+		constexpr bool is_open() const noexcept { return address != nullptr; }
+
+		constexpr cstr data() const noexcept { return address; }
+
+		constexpr usize size() const noexcept { return length; }
+	};
+} // namespace bleak
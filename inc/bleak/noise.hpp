@@ -0,0 +1,268 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <bit>
+#include <cstring>
+#include <type_traits>
+
+#include <bleak/simd.hpp>
+
+namespace bleak {
+	enum struct noise_e : u8 {
+		// smoothly interpolated random values at lattice points
+		Value,
+		// smoothly interpolated random gradients at lattice points
+		Perlin,
+		// random gradients at the corners of a skewed triangular lattice
+		Simplex
+	};
+
+	namespace noise {
+#if defined(BLEAK_SIMD_X86)
+		using f32x8 = f32 __attribute__((vector_size(32)));
+		using i32x8 = i32 __attribute__((vector_size(32)));
+		using u32x8 = u32 __attribute__((vector_size(32)));
+#endif
+
+		// every noise function is written once over a lane type; scalar lanes are a single f32 and wide lanes hold eight in one register
+		template<typename F> struct lane_t;
+
+		template<> struct lane_t<f32> {
+			using int_type = i32;
+			using uint_type = u32;
+
+			static constexpr usize width{ 1 };
+		};
+
+#if defined(BLEAK_SIMD_X86)
+		template<> struct lane_t<f32x8> {
+			using int_type = i32x8;
+			using uint_type = u32x8;
+
+			static constexpr usize width{ 8 };
+		};
+#endif
+
+		template<typename F> using int_of = typename lane_t<F>::int_type;
+		template<typename F> using uint_of = typename lane_t<F>::uint_type;
+
+		template<typename V, typename S> BLEAK_LANE_INLINE constexpr V splat(S value) noexcept { return V{} + value; }
+
+		template<typename F> BLEAK_LANE_INLINE constexpr int_of<F> to_int(F value) noexcept {
+			if constexpr (lane_t<F>::width == 1) {
+				return static_cast<int_of<F>>(value);
+			} else {
+				return __builtin_convertvector(value, int_of<F>);
+			}
+		}
+
+		template<typename F> BLEAK_LANE_INLINE constexpr F to_float(int_of<F> value) noexcept {
+			if constexpr (lane_t<F>::width == 1) {
+				return static_cast<F>(value);
+			} else {
+				return __builtin_convertvector(value, F);
+			}
+		}
+
+		template<typename F> BLEAK_LANE_INLINE constexpr int_of<F> floor(F value) noexcept {
+			const int_of<F> truncated{ to_int(value) };
+
+			return to_float<F>(truncated) > value ? truncated - 1 : truncated;
+		}
+
+		template<typename F> BLEAK_LANE_INLINE constexpr F lerp(F from, F to, F t) noexcept { return from + (to - from) * t; }
+
+		// quintic smoothstep with zero first and second derivatives at the lattice points
+		template<typename F> BLEAK_LANE_INLINE constexpr F fade(F t) noexcept { return t * t * t * (t * (t * 6.0f - 15.0f) + 10.0f); }
+
+		template<typename F> BLEAK_LANE_INLINE constexpr uint_of<F> hash(int_of<F> x, int_of<F> y, u32 seed) noexcept {
+			uint_of<F> state{ (std::bit_cast<uint_of<F>>(x) * 0x27D4EB2Du) ^ (std::bit_cast<uint_of<F>>(y) * 0x165667B1u) ^ seed };
+
+			state ^= state >> 15;
+			state *= 0x2C1B3C6Du;
+			state ^= state >> 12;
+			state *= 0x297A2D39u;
+			state ^= state >> 15;
+
+			return state;
+		}
+
+		// maps the top 24 bits of a hash onto [-1, 1)
+		template<typename F> BLEAK_LANE_INLINE constexpr F unit(uint_of<F> hash) noexcept { return to_float<F>(std::bit_cast<int_of<F>>(hash >> 8)) * (2.0f / 16777216.0f) - 1.0f; }
+
+		// dot product of offset (x, y) with one of four diagonal gradients
+		template<typename F> BLEAK_LANE_INLINE constexpr F gradient(uint_of<F> hash, F x, F y) noexcept { return ((hash & 1u) != 0u ? -x : x) + ((hash & 2u) != 0u ? -y : y); }
+
+		template<typename F> BLEAK_LANE_INLINE constexpr F value(F x, F y, u32 seed) noexcept {
+			using I = int_of<F>;
+
+			const I x0{ floor(x) };
+			const I y0{ floor(y) };
+
+			const F u{ fade(x - to_float<F>(x0)) };
+			const F v{ fade(y - to_float<F>(y0)) };
+
+			const F a{ unit<F>(hash<F>(x0, y0, seed)) };
+			const F b{ unit<F>(hash<F>(x0 + 1, y0, seed)) };
+			const F c{ unit<F>(hash<F>(x0, y0 + 1, seed)) };
+			const F d{ unit<F>(hash<F>(x0 + 1, y0 + 1, seed)) };
+
+			return lerp(lerp(a, b, u), lerp(c, d, u), v);
+		}
+
+		template<typename F> BLEAK_LANE_INLINE constexpr F perlin(F x, F y, u32 seed) noexcept {
+			using I = int_of<F>;
+
+			const I x0{ floor(x) };
+			const I y0{ floor(y) };
+
+			const F fx{ x - to_float<F>(x0) };
+			const F fy{ y - to_float<F>(y0) };
+
+			const F a{ gradient<F>(hash<F>(x0, y0, seed), fx, fy) };
+			const F b{ gradient<F>(hash<F>(x0 + 1, y0, seed), fx - 1.0f, fy) };
+			const F c{ gradient<F>(hash<F>(x0, y0 + 1, seed), fx, fy - 1.0f) };
+			const F d{ gradient<F>(hash<F>(x0 + 1, y0 + 1, seed), fx - 1.0f, fy - 1.0f) };
+
+			const F u{ fade(fx) };
+
+			return lerp(lerp(a, b, u), lerp(c, d, u), fade(fy));
+		}
+
+		template<typename F> BLEAK_LANE_INLINE constexpr F simplex_corner(uint_of<F> hash, F x, F y) noexcept {
+			F falloff{ 0.5f - x * x - y * y };
+
+			falloff = falloff < 0.0f ? splat<F>(0.0f) : falloff;
+			falloff *= falloff;
+
+			return falloff * falloff * gradient<F>(hash, x, y);
+		}
+
+		template<typename F> BLEAK_LANE_INLINE constexpr F simplex(F x, F y, u32 seed) noexcept {
+			using I = int_of<F>;
+
+			constexpr f32 skew{ 0.366025403784f };
+			constexpr f32 unskew{ 0.211324865405f };
+
+			const F s{ (x + y) * skew };
+
+			const I i{ floor(x + s) };
+			const I j{ floor(y + s) };
+
+			const F t{ to_float<F>(i + j) * unskew };
+
+			const F x0{ x - (to_float<F>(i) - t) };
+			const F y0{ y - (to_float<F>(j) - t) };
+
+			// the triangle containing the sample is chosen by which side of the diagonal it falls on
+			const I i1{ x0 > y0 ? splat<I>(1) : splat<I>(0) };
+			const I j1{ x0 > y0 ? splat<I>(0) : splat<I>(1) };
+
+			const F x1{ x0 - to_float<F>(i1) + unskew };
+			const F y1{ y0 - to_float<F>(j1) + unskew };
+
+			const F x2{ x0 - 1.0f + 2.0f * unskew };
+			const F y2{ y0 - 1.0f + 2.0f * unskew };
+
+			const F n{ simplex_corner<F>(hash<F>(i, j, seed), x0, y0) + simplex_corner<F>(hash<F>(i + i1, j + j1, seed), x1, y1) + simplex_corner<F>(hash<F>(i + 1, j + 1, seed), x2, y2) };
+
+			return n * 70.0f;
+		}
+
+		template<noise_e Noise, typename F> BLEAK_LANE_INLINE constexpr F basis(F x, F y, u32 seed) noexcept {
+			if constexpr (Noise == noise_e::Value) {
+				return value(x, y, seed);
+			} else if constexpr (Noise == noise_e::Perlin) {
+				return perlin(x, y, seed);
+			} else {
+				return simplex(x, y, seed);
+			}
+		}
+	} // namespace noise
+
+	// fractal coherent noise sampled at cell coordinates; every parameter is plain data so generators are cheap to copy into worker bands
+	template<noise_e Noise> struct noise_t {
+		u32 seed{ 0 };
+
+		// lattice cells per zone cell of the first octave
+		f32 frequency{ 1.0f / 32.0f };
+
+		u32 octaves{ 1 };
+
+		// frequency and amplitude multipliers between successive octaves
+		f32 lacunarity{ 2.0f };
+		f32 gain{ 0.5f };
+
+		// each sample is first displaced by up to this many cells of a second noise field; zero disables warping
+		f32 warp_amplitude{ 0.0f };
+		f32 warp_frequency{ 1.0f / 64.0f };
+
+		static constexpr u32 WarpSeedX{ 0x68E31DA4 };
+		static constexpr u32 WarpSeedY{ 0xB5297A4D };
+		static constexpr u32 OctaveSeed{ 0x1B56C4E9 };
+
+		// fbm of the basis normalised to roughly [-1, 1]
+		template<typename F> BLEAK_LANE_INLINE constexpr F evaluate(F x, F y) const noexcept {
+			if (warp_amplitude != 0.0f) {
+				const F warp_x{ noise::basis<Noise>(x * warp_frequency, y * warp_frequency, seed ^ WarpSeedX) };
+				const F warp_y{ noise::basis<Noise>(x * warp_frequency, y * warp_frequency, seed ^ WarpSeedY) };
+
+				x += warp_x * warp_amplitude;
+				y += warp_y * warp_amplitude;
+			}
+
+			F total{ noise::splat<F>(0.0f) };
+
+			f32 scale{ frequency };
+			f32 amplitude{ 1.0f };
+			f32 range{ 0.0f };
+
+			for (u32 octave{ 0 }; octave < octaves; ++octave) {
+				total += noise::basis<Noise>(x * scale, y * scale, seed + octave * OctaveSeed) * amplitude;
+
+				range += amplitude;
+
+				scale *= lacunarity;
+				amplitude *= gain;
+			}
+
+			return range > 0.0f ? total * (1.0f / range) : total;
+		}
+
+		constexpr f32 sample(f32 x, f32 y) const noexcept { return evaluate<f32>(x, y); }
+
+		// writes the samples at (x + i, y) for i in [0, width) to out; wide lanes cover eight cells per step where supported
+		inline void row(ptr<f32> out, usize width, f32 x, f32 y) const noexcept {
+			usize processed{ 0 };
+
+#if defined(BLEAK_SIMD_X86)
+			if (simd::detect() == simd::isa_e::AVX2) {
+				processed = avx2_row(out, width, x, y);
+			}
+#endif
+
+			for (usize i{ processed }; i < width; ++i) {
+				out[i] = sample(x + static_cast<f32>(i), y);
+			}
+		}
+
+	  private:
+#if defined(BLEAK_SIMD_X86)
+		BLEAK_TARGET_AVX2 inline usize avx2_row(ptr<f32> out, usize width, f32 x, f32 y) const noexcept {
+			const noise::f32x8 steps{ 0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f };
+			const noise::f32x8 row_y{ noise::splat<noise::f32x8>(y) };
+
+			usize i{ 0 };
+
+			for (; i + 8 <= width; i += 8) {
+				const noise::f32x8 samples{ evaluate<noise::f32x8>(steps + (x + static_cast<f32>(i)), row_y) };
+
+				std::memcpy(out + i, &samples, sizeof(samples));
+			}
+
+			return i;
+		}
+#endif
+	};
+} // namespace bleak
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <array>
+#include <bit>
+#include <limits>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace bleak {
+	// maps a number onto an unsigned key of the same width whose order matches the order of the numbers, negatives and floating point included
+	template<typename N>
+		requires std::is_arithmetic<N>::value
+	constexpr auto radix_key(N value) noexcept {
+		if constexpr (std::is_floating_point<N>::value) {
+			using key_t = std::conditional_t<sizeof(N) == sizeof(u32), u32, u64>;
+
+			constexpr key_t sign{ key_t{ 1 } << (std::numeric_limits<key_t>::digits - 1) };
+
+			const key_t bits{ std::bit_cast<key_t>(value) };
+
+			return (bits & sign) != 0 ? static_cast<key_t>(~bits) : static_cast<key_t>(bits | sign);
+		} else if constexpr (std::is_signed<N>::value) {
+			using key_t = std::make_unsigned_t<std::conditional_t<(sizeof(N) < sizeof(u32)), i32, N>>;
+
+			constexpr key_t sign{ key_t{ 1 } << (std::numeric_limits<key_t>::digits - 1) };
+
+			return static_cast<key_t>(static_cast<key_t>(value) ^ sign);
+		} else {
+			return static_cast<std::conditional_t<(sizeof(N) < sizeof(u32)), u32, N>>(value);
+		}
+	}
+
+	template<typename N> using radix_key_t = decltype(radix_key(N{}));
+
+	// monotone priority queue for propagating distances outward; every key pushed must be no lower than the last key popped
+	// entries sit in one bucket per leading bit in which their key differs from the last key popped, so each entry is only ever redistributed towards the front
+	// buckets keep their storage when cleared, so a reused heap stops allocating once it has seen its largest frontier
+	template<typename T, typename Key = u32>
+		requires std::is_unsigned<Key>::value
+	struct radix_heap_t {
+		using key_t = Key;
+		using entry_t = std::pair<Key, T>;
+
+		static constexpr usize bucket_count{ std::numeric_limits<Key>::digits + 1 };
+
+	  private:
+		std::array<std::vector<entry_t>, bucket_count> buckets;
+
+		Key last;
+		usize count;
+
+		constexpr usize bucket_of(Key key) const noexcept { return key == last ? 0 : static_cast<usize>(std::bit_width(static_cast<Key>(key ^ last))); }
+
+	  public:
+		inline radix_heap_t() noexcept : buckets{}, last{ 0 }, count{ 0 } {}
+
+		constexpr usize size() const noexcept { return count; }
+
+		constexpr bool empty() const noexcept { return count == 0; }
+
+		// the lowest key that may still be pushed
+		constexpr Key floor() const noexcept { return last; }
+
+		constexpr void clear() noexcept {
+			for (rauto bucket : buckets) {
+				bucket.clear();
+			}
+
+			last = 0;
+			count = 0;
+		}
+
+		constexpr void push(Key key, cref<T> value) noexcept {
+			buckets[bucket_of(key)].emplace_back(key, value);
+
+			++count;
+		}
+
+		// only meaningful when the heap is not empty; entries of equal keys pop in no particular order
+		constexpr entry_t pop() noexcept {
+			if (buckets[0].empty()) {
+				usize i{ 1 };
+
+				while (buckets[i].empty()) {
+					++i;
+				}
+
+				Key lowest{ buckets[i].front().first };
+
+				for (crauto entry : buckets[i]) {
+					lowest = entry.first < lowest ? entry.first : lowest;
+				}
+
+				last = lowest;
+
+				for (crauto entry : buckets[i]) {
+					buckets[bucket_of(entry.first)].push_back(entry);
+				}
+
+				buckets[i].clear();
+			}
+
+			const entry_t entry{ buckets[0].back() };
+
+			buckets[0].pop_back();
+
+			--count;
+
+			return entry;
+		}
+	};
+} // namespace bleak
@@ -3,12 +3,17 @@
 #include <bleak/typedef.hpp>
 
 #include <fstream>
+#include <random>
 #include <utility>
 
+#include <bleak/camera.hpp>
+#include <bleak/codec.hpp>
 #include <bleak/extent.hpp>
 #include <bleak/log.hpp>
 #include <bleak/offset.hpp>
+#include <bleak/random.hpp>
 #include <bleak/renderer.hpp>
+#include <bleak/thread_pool.hpp>
 #include <bleak/zone.hpp>
 
 namespace bleak {
@@ -115,6 +120,48 @@ namespace bleak {
 
 		constexpr cref<T> operator[](cref<region_offset_t> position) const noexcept { return zones[position.zone][position.cell]; }
 
+		// seed of the random stream of the zone at position; depends only on the world seed and the coordinate so streams never overlap in use
+		static constexpr u64 zone_seed(u64 seed, offset_t position) noexcept {
+			u64 state{ seed + 0x9E3779B97F4A7C15 * ((static_cast<u64>(static_cast<u32>(position.y)) << 32 | static_cast<u32>(position.x)) + 1) };
+
+			state = (state ^ (state >> 30)) * 0xBF58476D1CE4E5B9;
+			state = (state ^ (state >> 27)) * 0x94D049BB133111EB;
+
+			return state ^ (state >> 31);
+		}
+
+		template<RandomEngine Randomizer> static inline Randomizer zone_generator(u64 seed, offset_t position) noexcept {
+			const u64 state{ zone_seed(seed, position) };
+
+			std::seed_seq sequence{ static_cast<u32>(state), static_cast<u32>(state >> 32) };
+
+			return Randomizer{ sequence };
+		}
+
+		// generates each zone from its own stream seeded by zone_generator, passing params on to zone_t::generate; the result is independent of zone order
+		template<zone_region_e Region, RandomEngine Randomizer = std::mt19937, typename... Params> inline ref<region_t> generate(u64 seed, cref<Params>... params) noexcept {
+			for (extent_t::product_t i{ 0 }; i < region_area; ++i) {
+				Randomizer generator{ zone_generator<Randomizer>(seed, decltype(zones)::unflatten(static_cast<usize>(i))) };
+
+				zones[i].template generate<Region>(generator, params...);
+			}
+
+			return *this;
+		}
+
+		// as above with zones spread across the pool; identical output for any number of workers
+		template<zone_region_e Region, RandomEngine Randomizer = std::mt19937, typename... Params> inline ref<region_t> generate(ref<thread_pool_t> pool, u64 seed, cref<Params>... params) noexcept {
+			pool.parallel_for(0, static_cast<isize>(region_area), [&](isize first, isize last) {
+				for (isize i{ first }; i < last; ++i) {
+					Randomizer generator{ zone_generator<Randomizer>(seed, decltype(zones)::unflatten(static_cast<usize>(i))) };
+
+					zones[i].template generate<Region>(generator, params...);
+				}
+			});
+
+			return *this;
+		}
+
 		constexpr zone_t<T, RegionSize * ZoneSize, ZoneBorder> compile() const noexcept {
 			zone_t<T, RegionSize * ZoneSize, ZoneBorder> zone{};
 
@@ -180,6 +227,61 @@ namespace bleak {
 			}
 		}
 
+	  private:
+		// zones overlapped by the camera's viewport grown by margin, as an inclusive range of zone positions
+		static constexpr bool visible_zones(cref<camera_t> camera, extent_t margin, ref<offset_t> first, ref<offset_t> last) noexcept {
+			const offset_t position{ camera.get_position() };
+			const extent_t viewport{ camera.get_size() };
+
+			if (viewport.w <= 0 || viewport.h <= 0) {
+				return false;
+			}
+
+			const offset_t::scalar_t left{ max<offset_t::scalar_t>(position.x - margin.w, 0) };
+			const offset_t::scalar_t top{ max<offset_t::scalar_t>(position.y - margin.h, 0) };
+			const offset_t::scalar_t right{ min<offset_t::scalar_t>(position.x + viewport.w + margin.w, size.w) - 1 };
+			const offset_t::scalar_t bottom{ min<offset_t::scalar_t>(position.y + viewport.h + margin.h, size.h) - 1 };
+
+			if (left > right || top > bottom) {
+				return false;
+			}
+
+			first = offset_t{ left / zone_size.w, top / zone_size.h };
+			last = offset_t{ right / zone_size.w, bottom / zone_size.h };
+
+			return true;
+		}
+
+	  public:
+		// zones outside the camera's viewport plus margin are skipped entirely and those within it only visit their visible cells
+		template<bool Simple = false, extent_t AtlasSize>
+			requires is_drawable<T>::value
+		constexpr void draw(cref<atlas_t<AtlasSize>> atlas, cref<camera_t> camera, offset_t offset, extent_t margin = extent_t::Zero) const noexcept {
+			offset_t first{};
+			offset_t last{};
+
+			if (!visible_zones(camera, margin, first, last)) {
+				return;
+			}
+
+			for (extent_t::scalar_t y{ first.y }; y <= last.y; ++y) {
+				for (extent_t::scalar_t x{ first.x }; x <= last.x; ++x) {
+					const offset_t pos{ x, y };
+
+					// the zone draws its cells relative to a camera translated into its own coordinates
+					const camera_t local{ camera.get_size(), camera.get_position() - zone_origin(pos) };
+
+					(*this)[pos].template draw<Simple>(atlas, local, offset, margin);
+				}
+			}
+		}
+
+		template<bool Simple = false, extent_t AtlasSize>
+			requires is_drawable<T>::value
+		constexpr void draw(cref<atlas_t<AtlasSize>> atlas, cref<camera_t> camera, extent_t margin = extent_t::Zero) const noexcept {
+			draw<Simple>(atlas, camera, offset_t::Zero, margin);
+		}
+
 		constexpr bool serialize(cref<std::string> path) const noexcept {
 			std::ofstream file{};
 
@@ -199,5 +301,102 @@ namespace bleak {
 				zones[i].deserialize(buffer + i *  zone_type::byte_size);
 			}
 		}
+
+		static constexpr codec::header_t header(u64 checksum) noexcept { return codec::header_t{ static_cast<u16>(sizeof(T)), zone_size, ZoneBorder, region_size, checksum }; }
+
+		// every zone encoded back to back under a single header; the checksum spans all of them in storage order
+		inline bool encode(ref<std::ostream> stream) const noexcept {
+			u64 checksum{ codec::ChecksumSeed };
+
+			for (extent_t::product_t i{ 0 }; i < region_area; ++i) {
+				checksum = zones[i].checksum(checksum);
+			}
+
+			if (!codec::write_header(stream, header(checksum))) {
+				return false;
+			}
+
+			for (extent_t::product_t i{ 0 }; i < region_area; ++i) {
+				if (!zones[i].encode_rows(stream)) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		inline bool encode(cref<std::string> path) const noexcept {
+			std::ofstream file{ path, std::ios::out | std::ios::binary };
+
+			if (!file.is_open()) {
+				error_log.add("failed to open \"{}\" for writing!", path);
+				return false;
+			}
+
+			return encode(file);
+		}
+
+		inline bool decode(ref<std::istream> stream) noexcept {
+			codec::header_t file_header{};
+
+			if (!codec::read_header(stream, file_header) || !file_header.matches(header(0))) {
+				return false;
+			}
+
+			// as for a zone, the body is verified in full before it is decoded in place, so a failed load leaves the region as it was without holding a second copy of it
+			const std::istream::pos_type body{ stream.tellg() };
+
+			if (body == std::istream::pos_type(-1)) {
+				error_log.add("encoded region must be read from a seekable stream!");
+				return false;
+			}
+
+			u64 running{ codec::ChecksumSeed };
+
+			for (extent_t::product_t i{ 0 }; i < region_area; ++i) {
+				if (!zone_type::decode_rows(stream, file_header.compression, running, nullptr)) {
+					return false;
+				}
+			}
+
+			if (running != file_header.checksum) {
+				error_log.add("checksum mismatch in encoded region!");
+				return false;
+			}
+
+			stream.seekg(body);
+
+			if (!stream.good()) {
+				error_log.add("failed to rewind encoded region!");
+				return false;
+			}
+
+			running = codec::ChecksumSeed;
+
+			for (extent_t::product_t i{ 0 }; i < region_area; ++i) {
+				if (!zones[i].decode_rows(stream, file_header.compression, running)) {
+					error_log.add("encoded region changed while it was being read!");
+					return false;
+				}
+			}
+
+			if (running != file_header.checksum) {
+				error_log.add("encoded region changed while it was being read!");
+				return false;
+			}
+
+			return true;
+		}
+
+		inline bool decode(cref<std::string> path) noexcept {
+			std::ifstream file{ path, std::ios::in | std::ios::binary };
+
+			if (!file.is_open()) {
+				error_log.add("failed to open \"{}\" for reading!", path);
+				return false;
+			}
+
+			return decode(file);
+		}
 	};
 } // namespace bleak
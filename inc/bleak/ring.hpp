@@ -0,0 +1,69 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <utility>
+#include <vector>
+
+#include <bleak/utility.hpp>
+
+namespace bleak {
+	// first-in first-out queue over storage allocated once at construction; clearing keeps the storage, so a reused ring never allocates
+	template<typename T> struct ring_t {
+	  private:
+		std::vector<T> storage;
+
+		usize head;
+		usize length;
+
+	  public:
+		inline ring_t(usize capacity) noexcept : storage(max<usize>(capacity, 1)), head{ 0 }, length{ 0 } {}
+
+		constexpr usize capacity() const noexcept { return storage.size(); }
+
+		constexpr usize size() const noexcept { return length; }
+
+		constexpr bool empty() const noexcept { return length == 0; }
+
+		constexpr bool full() const noexcept { return length == storage.size(); }
+
+		constexpr void clear() noexcept {
+			head = 0;
+			length = 0;
+		}
+
+		constexpr cref<T> front() const noexcept { return storage[head]; }
+
+		// returns false and leaves the ring untouched when it is full
+		constexpr bool push(cref<T> value) noexcept {
+			if (full()) {
+				return false;
+			}
+
+			usize tail{ head + length };
+
+			if (tail >= storage.size()) {
+				tail -= storage.size();
+			}
+
+			storage[tail] = value;
+
+			++length;
+
+			return true;
+		}
+
+		// only meaningful when the ring is not empty
+		constexpr T pop() noexcept {
+			T value{ std::move(storage[head]) };
+
+			if (++head == storage.size()) {
+				head = 0;
+			}
+
+			--length;
+
+			return value;
+		}
+	};
+} // namespace bleak
@@ -0,0 +1,280 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <optional>
+#include <random>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <bleak/array.hpp>
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/random.hpp>
+
+namespace bleak {
+	// maintains per-value lists of cell indices split into interior and border cells for constant time uniform sampling
+	// intended for zones holding a handful of distinct values such as tile or terrain types
+	template<typename T, extent_t Size, extent_t BorderSize> struct sampler_t {
+		static constexpr extent_t zone_size{ Size };
+		static constexpr extent_t border_size{ BorderSize };
+		static constexpr extent_t interior_size{ Size - BorderSize };
+
+		static constexpr offset_t interior_origin{ offset_t{ 0 } + border_size };
+		static constexpr offset_t interior_extent{ interior_origin + interior_size - border_size };
+
+		static constexpr extent_t::product_t zone_area{ zone_size.area() };
+
+		static constexpr bool is_interior(offset_t position) noexcept { return position.x >= interior_origin.x && position.x <= interior_extent.x && position.y >= interior_origin.y && position.y <= interior_extent.y; }
+
+	  private:
+		struct bucket_t {
+			T value;
+
+			std::vector<u32> interior;
+			std::vector<u32> border;
+
+			constexpr ref<std::vector<u32>> list(bool interior_cell) noexcept { return interior_cell ? interior : border; }
+		};
+
+		std::vector<bucket_t> buckets;
+		std::vector<u32> slots;
+
+		bool stale;
+
+		constexpr usize find_bucket(cref<T> value) const noexcept {
+			for (usize i{ 0 }; i < buckets.size(); ++i) {
+				if (buckets[i].value == value) {
+					return i;
+				}
+			}
+
+			return buckets.size();
+		}
+
+		constexpr usize acquire_bucket(cref<T> value) noexcept {
+			const usize index{ find_bucket(value) };
+
+			if (index == buckets.size()) {
+				buckets.push_back(bucket_t{ value, {}, {} });
+			}
+
+			return index;
+		}
+
+		static constexpr offset_t unflatten(u32 index) noexcept { return offset_t{ static_cast<offset_t::scalar_t>(index % zone_size.w), static_cast<offset_t::scalar_t>(index / zone_size.w) }; }
+
+		// total number of candidates matching the value within the selected lists
+		template<typename U> constexpr usize candidates(cref<U> value, bool interior, bool border) const noexcept {
+			usize total{ 0 };
+
+			for (crauto bucket : buckets) {
+				if (!(bucket.value == value)) {
+					continue;
+				}
+
+				total += (interior ? bucket.interior.size() : 0) + (border ? bucket.border.size() : 0);
+			}
+
+			return total;
+		}
+
+		// maps a position within the concatenation of the selected lists back to its cell
+		template<typename U> constexpr offset_t candidate(cref<U> value, bool interior, bool border, usize index) const noexcept {
+			for (crauto bucket : buckets) {
+				if (!(bucket.value == value)) {
+					continue;
+				}
+
+				if (interior) {
+					if (index < bucket.interior.size()) {
+						return unflatten(bucket.interior[index]);
+					}
+
+					index -= bucket.interior.size();
+				}
+
+				if (border) {
+					if (index < bucket.border.size()) {
+						return unflatten(bucket.border[index]);
+					}
+
+					index -= bucket.border.size();
+				}
+			}
+
+			return offset_t{ 0 };
+		}
+
+	  public:
+		inline sampler_t() noexcept : buckets{}, slots(zone_area, 0), stale{ true } {}
+
+		inline sampler_t(cref<array_t<T, Size>> cells) noexcept : buckets{}, slots(zone_area, 0), stale{ true } { rebuild(cells); }
+
+		inline sampler_t(cref<sampler_t> other) noexcept : buckets{ other.buckets }, slots{ other.slots }, stale{ other.stale } {}
+
+		inline sampler_t(rval<sampler_t> other) noexcept : buckets{ std::move(other.buckets) }, slots{ std::move(other.slots) }, stale{ other.stale } {}
+
+		inline ref<sampler_t> operator=(cref<sampler_t> other) noexcept {
+			if (this != &other) {
+				buckets = other.buckets;
+				slots = other.slots;
+				stale = other.stale;
+			}
+
+			return *this;
+		}
+
+		inline ref<sampler_t> operator=(rval<sampler_t> other) noexcept {
+			if (this != &other) {
+				buckets = std::move(other.buckets);
+				slots = std::move(other.slots);
+				stale = other.stale;
+			}
+
+			return *this;
+		}
+
+		inline ~sampler_t() noexcept {}
+
+		constexpr bool is_stale() const noexcept { return stale; }
+
+		constexpr void invalidate() noexcept { stale = true; }
+
+		constexpr void rebuild(cref<array_t<T, Size>> cells) noexcept {
+			for (auto& bucket : buckets) {
+				bucket.interior.clear();
+				bucket.border.clear();
+			}
+
+			usize last{ buckets.size() };
+
+			for (offset_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+				for (offset_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+					const u32 index{ static_cast<u32>(static_cast<usize>(y) * zone_size.w + x) };
+
+					cref<T> value{ cells[x, y] };
+
+					// runs of equal values are common so the previous bucket is tried first
+					if (last == buckets.size() || !(buckets[last].value == value)) {
+						last = acquire_bucket(value);
+					}
+
+					ref<std::vector<u32>> list{ buckets[last].list(is_interior(offset_t{ x, y })) };
+
+					slots[index] = static_cast<u32>(list.size());
+					list.push_back(index);
+				}
+			}
+
+			stale = false;
+		}
+
+		// moves a single cell between lists in constant time for a handful of distinct values
+		constexpr void update(offset_t position, cref<T> previous, cref<T> current) noexcept {
+			if (stale || previous == current) {
+				return;
+			}
+
+			const u32 index{ static_cast<u32>(static_cast<usize>(position.y) * zone_size.w + position.x) };
+			const bool interior_cell{ is_interior(position) };
+
+			const usize previous_bucket{ find_bucket(previous) };
+
+			if (previous_bucket == buckets.size()) {
+				stale = true;
+				return;
+			}
+
+			ref<std::vector<u32>> previous_list{ buckets[previous_bucket].list(interior_cell) };
+
+			const u32 slot{ slots[index] };
+			const u32 moved{ previous_list.back() };
+
+			previous_list[slot] = moved;
+			slots[moved] = slot;
+			previous_list.pop_back();
+
+			ref<std::vector<u32>> current_list{ buckets[acquire_bucket(current)].list(interior_cell) };
+
+			slots[index] = static_cast<u32>(current_list.size());
+			current_list.push_back(index);
+		}
+
+		template<typename U = T>
+			requires is_equatable<T, U>::value
+		constexpr usize count(cref<U> value, bool interior, bool border) const noexcept {
+			return candidates(value, interior, border);
+		}
+
+		// occurrences of every indexed value within the selected lists; kept current by update so reading it costs one step per distinct value
+		inline std::vector<std::pair<T, usize>> histogram(bool interior, bool border) const noexcept {
+			std::vector<std::pair<T, usize>> counts{};
+
+			counts.reserve(buckets.size());
+
+			for (crauto bucket : buckets) {
+				const usize total{ (interior ? bucket.interior.size() : 0) + (border ? bucket.border.size() : 0) };
+
+				if (total > 0) {
+					counts.emplace_back(bucket.value, total);
+				}
+			}
+
+			return counts;
+		}
+
+		template<RandomEngine Randomizer, typename U = T>
+			requires is_random_engine<Randomizer>::value && is_equatable<T, U>::value
+		constexpr std::optional<offset_t> sample(ref<Randomizer> generator, cref<U> value, bool interior, bool border) const noexcept {
+			const usize total{ candidates(value, interior, border) };
+
+			if (total == 0) {
+				return std::nullopt;
+			}
+
+			std::uniform_int_distribution<usize> dis{ 0, total - 1 };
+
+			return candidate(value, interior, border, dis(generator));
+		}
+
+		// draws candidates without replacement until one is not rejected; uniform over the accepted candidates and only fails when there are none
+		template<RandomEngine Randomizer, typename U, typename Rejector>
+			requires is_random_engine<Randomizer>::value && is_equatable<T, U>::value && std::is_invocable_r<bool, Rejector, offset_t>::value
+		inline std::optional<offset_t> sample(ref<Randomizer> generator, cref<U> value, bool interior, bool border, cref<Rejector> rejected) const noexcept {
+			const usize total{ candidates(value, interior, border) };
+
+			if (total == 0) {
+				return std::nullopt;
+			}
+
+			// sparse fisher-yates shuffle; only displaced entries of the permutation are stored
+			std::unordered_map<usize, usize> displaced{};
+
+			cauto permutation = [&displaced](usize index) -> usize {
+				cauto iter{ displaced.find(index) };
+
+				return iter != displaced.end() ? iter->second : index;
+			};
+
+			for (usize i{ 0 }; i < total; ++i) {
+				std::uniform_int_distribution<usize> dis{ i, total - 1 };
+
+				const usize j{ dis(generator) };
+				const usize chosen{ permutation(j) };
+
+				displaced[j] = permutation(i);
+
+				const offset_t position{ candidate(value, interior, border, chosen) };
+
+				if (!rejected(position)) {
+					return position;
+				}
+			}
+
+			return std::nullopt;
+		}
+	};
+} // namespace bleak
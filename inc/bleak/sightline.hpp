@@ -0,0 +1,245 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <cstdlib>
+#include <limits>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <bleak/bitboard.hpp>
+#include <bleak/dirty.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/hash.hpp>
+#include <bleak/log.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/thread_pool.hpp>
+#include <bleak/zone.hpp>
+
+namespace bleak {
+	struct sight_query_t {
+		offset_t origin;
+		offset_t target;
+
+		u32 distance{ std::numeric_limits<u32>::max() };
+
+		constexpr bool operator==(cref<sight_query_t> other) const noexcept { return origin == other.origin && target == other.target && distance == other.distance; }
+
+		struct hasher {
+			static constexpr usize operator()(cref<sight_query_t> query) noexcept { return hash_combine(query.origin.x, query.origin.y, query.target.x, query.target.y, query.distance); }
+		};
+	};
+
+	// answers batches of linear_blockage queries against a bit-packed copy of the blockers of a zone
+	// results are cached by query and the cache is dropped once the zone's change tracking reports a write; only the dirty tiles of the blocker board are repacked
+	template<typename T, extent_t Size, extent_t BorderSize = extent_t::Zero> struct sightline_t {
+		using zone_type = zone_t<T, Size, BorderSize>;
+		using dirty_type = dirty_t<Size>;
+
+		// the cache is emptied rather than grown beyond this many entries
+		static constexpr usize cache_limit{ 1 << 16 };
+
+	  private:
+		ptr<zone_type> zone;
+		T blocker;
+
+		cptr<dirty_type> subscription;
+		typename dirty_type::consumer_t consumer;
+
+		bitboard_t<Size> blockers;
+
+		std::unordered_map<sight_query_t, bool, sight_query_t::hasher> cache;
+
+		std::vector<usize> misses;
+
+		// tracking may have been disabled or recreated since the last repack, in which case writes went unrecorded and the consumer is no longer ours
+		// a fresh subscription sees every tile as dirty, so the repack that follows covers the whole board
+		inline void resubscribe() noexcept {
+			subscription = zone->enable_tracking().tracking();
+			consumer = zone->tracking()->subscribe();
+		}
+
+		inline void repack() noexcept {
+			if (zone->tracking() != subscription || !subscription->is_subscribed(consumer)) {
+				resubscribe();
+			}
+
+			cptr<dirty_type> tracker{ zone->tracking() };
+
+			if (!tracker->any(consumer)) {
+				return;
+			}
+
+			cache.clear();
+
+			const auto dirty_tiles{ tracker->tiles(consumer) };
+
+			for (offset_t::scalar_t tile_y{ 0 }; tile_y < dirty_type::tile_count.h; ++tile_y) {
+				for (offset_t::scalar_t tile_x{ 0 }; tile_x < dirty_type::tile_count.w; ++tile_x) {
+					if (!dirty_tiles[tile_x, tile_y]) {
+						continue;
+					}
+
+					const offset_t origin{ tile_x * dirty_type::tile_size.w, tile_y * dirty_type::tile_size.h };
+					const offset_t extent{ min<offset_t::scalar_t>(origin.x + dirty_type::tile_size.w, Size.w), min<offset_t::scalar_t>(origin.y + dirty_type::tile_size.h, Size.h) };
+
+					for (offset_t::scalar_t y{ origin.y }; y < extent.y; ++y) {
+						for (offset_t::scalar_t x{ origin.x }; x < extent.x; ++x) {
+							blockers.set(x, y, std::as_const(*zone)[x, y] == blocker);
+						}
+					}
+				}
+			}
+
+			zone->tracking()->clear(consumer);
+		}
+
+		// bresenham walk identical to zone_t::linear_blockage but testing bits of the blocker board
+		inline bool trace(cref<sight_query_t> query) const noexcept {
+			const offset_t origin{ query.origin };
+			const offset_t target{ query.target };
+
+			if (blockers[origin] || blockers[target]) {
+				return true;
+			}
+
+			if (origin == target) {
+				return false;
+			}
+
+			const offset_t delta{ std::abs(target.x - origin.x), std::abs(target.y - origin.y) };
+			const offset_t step{ origin.x < target.x ? 1 : -1, origin.y < target.y ? 1 : -1 };
+
+			i32 err{ delta.x - delta.y };
+
+			offset_t position{ origin };
+			u32 distance{ 0 };
+
+			for (;;) {
+				if (position == target) {
+					return false;
+				}
+
+				if (blockers[position]) {
+					return true;
+				}
+
+				const i32 e2{ 2 * err };
+
+				if (distance >= query.distance) {
+					return false;
+				}
+
+				if (e2 > -delta.y) {
+					err -= delta.y;
+					position.x += step.x;
+				}
+
+				if (e2 < delta.x) {
+					err += delta.x;
+					position.y += step.y;
+				}
+
+				++distance;
+			}
+		}
+
+		template<typename Evaluate> inline void batch(std::span<const sight_query_t> queries, std::span<bool> results, cref<Evaluate> evaluate) noexcept {
+			if (results.size() < queries.size()) {
+				error_log.add("sightline results must hold an entry for every query!");
+				return;
+			}
+
+			repack();
+
+			misses.clear();
+
+			for (usize i{ 0 }; i < queries.size(); ++i) {
+				cauto iter{ cache.find(queries[i]) };
+
+				if (iter != cache.end()) {
+					results[i] = iter->second;
+				} else {
+					misses.push_back(i);
+				}
+			}
+
+			evaluate();
+
+			if (cache.size() + misses.size() > cache_limit) {
+				cache.clear();
+			}
+
+			for (cauto i : misses) {
+				cache.emplace(queries[i], results[i]);
+			}
+		}
+
+	  public:
+		// enables change tracking on the zone if it is not already and subscribes to it; the zone must outlive the sightline
+		inline sightline_t(ref<zone_type> zone, cref<T> blocker) noexcept : zone{ &zone }, blocker{ blocker }, subscription{ nullptr }, consumer{ 0 }, blockers{}, cache{}, misses{} { resubscribe(); }
+
+		inline sightline_t(cref<sightline_t> other) noexcept = delete;
+		inline ref<sightline_t> operator=(cref<sightline_t> other) noexcept = delete;
+
+		inline ~sightline_t() noexcept {
+			if (zone->tracking() == subscription && subscription != nullptr) {
+				zone->tracking()->unsubscribe(consumer);
+			}
+		}
+
+		constexpr cref<T> blocking_value() const noexcept { return blocker; }
+
+		constexpr usize cached() const noexcept { return cache.size(); }
+
+		inline void invalidate() noexcept {
+			cache.clear();
+			zone->mark_dirty();
+		}
+
+		// equivalent to zone.linear_blockage(origin, target, blocker, distance)
+		inline bool blocked(cref<sight_query_t> query) noexcept {
+			repack();
+
+			cauto iter{ cache.find(query) };
+
+			if (iter != cache.end()) {
+				return iter->second;
+			}
+
+			const bool result{ trace(query) };
+
+			if (cache.size() >= cache_limit) {
+				cache.clear();
+			}
+
+			cache.emplace(query, result);
+
+			return result;
+		}
+
+		inline bool blocked(offset_t origin, offset_t target, u32 distance = std::numeric_limits<u32>::max()) noexcept { return blocked(sight_query_t{ origin, target, distance }); }
+
+		// writes whether each query is blocked to the matching entry of results
+		inline void blocked(std::span<const sight_query_t> queries, std::span<bool> results) noexcept {
+			batch(queries, results, [&]() {
+				for (cauto i : misses) {
+					results[i] = trace(queries[i]);
+				}
+			});
+		}
+
+		// as above with the uncached queries traced in bands across the pool
+		inline void blocked(ref<thread_pool_t> pool, std::span<const sight_query_t> queries, std::span<bool> results) noexcept {
+			batch(queries, results, [&]() {
+				pool.parallel_for(0, static_cast<isize>(misses.size()), 64, [&](isize first, isize last) {
+					for (isize i{ first }; i < last; ++i) {
+						results[misses[i]] = trace(queries[misses[i]]);
+					}
+				});
+			});
+		}
+	};
+} // namespace bleak
@@ -0,0 +1,416 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <array>
+#include <bit>
+#include <type_traits>
+
+#include <bleak/concepts.hpp>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	#define BLEAK_SIMD_X86
+
+	#include <immintrin.h>
+
+	#define BLEAK_TARGET_SSE __attribute__((target("sse4.2")))
+	#define BLEAK_TARGET_AVX2 __attribute__((target("avx2")))
+
+	// lane generic helpers must be inlined into their target-specific callers, since wide vectors cannot cross between functions of differing targets
+	#define BLEAK_LANE_INLINE __attribute__((always_inline))
+#else
+	#define BLEAK_LANE_INLINE
+#endif
+
+namespace bleak {
+	namespace simd {
+		enum struct isa_e : u8 {
+			Scalar,
+			SSE,
+			AVX2
+		};
+
+		// kernels evaluated over a row; every kernel treats neighbours beyond the zone as matching
+		enum struct kernel_e : u8 {
+			NeighbourCount,
+			Moore,
+			VonNeumann,
+			MarchingSquares,
+			Melded
+		};
+
+		// cell types whose equality is bitwise and whose width fits the byte and word lane kernels
+		template<typename T> struct is_vectorizable {
+			static constexpr bool value = (std::is_integral<T>::value || std::is_enum<T>::value) && std::has_unique_object_representations<T>::value && (sizeof(T) == 1 || sizeof(T) == 2);
+		};
+
+		template<typename T> constexpr bool is_vectorizable_v = is_vectorizable<T>::value;
+
+		template<typename T> concept Vectorizable = is_vectorizable<T>::value;
+
+		inline isa_e detect() noexcept {
+#if defined(BLEAK_SIMD_X86)
+			static const isa_e isa{ [] {
+				__builtin_cpu_init();
+
+				if (__builtin_cpu_supports("avx2")) {
+					return isa_e::AVX2;
+				} else if (__builtin_cpu_supports("sse4.2")) {
+					return isa_e::SSE;
+				}
+
+				return isa_e::Scalar;
+			}() };
+
+			return isa;
+#else
+			return isa_e::Scalar;
+#endif
+		}
+
+		// planes are ordered northwest, north, northeast, west, center, east, southwest, south, southeast
+		// each index bit is set when all three of its planes match; single-plane bits repeat the plane
+		struct term_t {
+			u8 first;
+			u8 second;
+			u8 third;
+			u8 bit;
+		};
+
+		template<kernel_e Kernel> struct kernel_terms;
+
+		template<> struct kernel_terms<kernel_e::Moore> {
+			static constexpr std::array<term_t, 8> terms{ { { 0, 0, 0, 1 << 7 }, { 1, 1, 1, 1 << 6 }, { 2, 2, 2, 1 << 5 }, { 3, 3, 3, 1 << 4 }, { 5, 5, 5, 1 << 3 }, { 6, 6, 6, 1 << 2 }, { 7, 7, 7, 1 << 1 }, { 8, 8, 8, 1 << 0 } } };
+		};
+
+		template<> struct kernel_terms<kernel_e::VonNeumann> {
+			static constexpr std::array<term_t, 4> terms{ { { 1, 1, 1, 1 << 3 }, { 5, 5, 5, 1 << 2 }, { 7, 7, 7, 1 << 1 }, { 3, 3, 3, 1 << 0 } } };
+		};
+
+		template<> struct kernel_terms<kernel_e::MarchingSquares> {
+			static constexpr std::array<term_t, 4> terms{ { { 4, 4, 4, 1 << 3 }, { 5, 5, 5, 1 << 2 }, { 8, 8, 8, 1 << 1 }, { 7, 7, 7, 1 << 0 } } };
+		};
+
+		template<> struct kernel_terms<kernel_e::Melded> {
+			static constexpr std::array<term_t, 4> terms{ { { 0, 1, 3, 1 << 3 }, { 1, 2, 5, 1 << 2 }, { 5, 8, 7, 1 << 1 }, { 3, 6, 7, 1 << 0 } } };
+		};
+
+		// evaluates cells [first, last) of a row of the given width; a null north or south row lies beyond the zone
+		template<kernel_e Kernel, typename T, typename U>
+			requires is_equatable<T, U>::value
+		inline void scalar_row(cptr<T> north, cptr<T> central, cptr<T> south, usize width, cref<U> value, ptr<u8> out, usize first, usize last) noexcept {
+			const cptr<T> rows[3]{ north, central, south };
+
+			for (usize x{ first }; x < last; ++x) {
+				bool planes[9];
+
+				for (usize j{ 0 }; j < 3; ++j) {
+					for (usize i{ 0 }; i < 3; ++i) {
+						const isize column{ static_cast<isize>(x + i) - 1 };
+
+						planes[j * 3 + i] = rows[j] == nullptr || column < 0 || column >= static_cast<isize>(width) || rows[j][column] == value;
+					}
+				}
+
+				u8 result{ 0 };
+
+				if constexpr (Kernel == kernel_e::NeighbourCount) {
+					for (usize i{ 0 }; i < 9; ++i) {
+						if (i != 4 && planes[i]) {
+							++result;
+						}
+					}
+				} else {
+					for (cauto term : kernel_terms<Kernel>::terms) {
+						if (planes[term.first] && planes[term.second] && planes[term.third]) {
+							result |= term.bit;
+						}
+					}
+				}
+
+				out[x] = result;
+			}
+		}
+
+#if defined(BLEAK_SIMD_X86)
+		template<typename E> struct sse_ops_t {
+			using vector_t = __m128i;
+
+			static constexpr usize lanes{ 16 };
+
+			BLEAK_TARGET_SSE static inline vector_t zero() noexcept { return _mm_setzero_si128(); }
+
+			BLEAK_TARGET_SSE static inline vector_t ones() noexcept { return _mm_set1_epi8(-1); }
+
+			BLEAK_TARGET_SSE static inline vector_t broadcast(u8 value) noexcept { return _mm_set1_epi8(static_cast<char>(value)); }
+
+			BLEAK_TARGET_SSE static inline vector_t bitwise_and(vector_t lhs, vector_t rhs) noexcept { return _mm_and_si128(lhs, rhs); }
+
+			BLEAK_TARGET_SSE static inline vector_t bitwise_or(vector_t lhs, vector_t rhs) noexcept { return _mm_or_si128(lhs, rhs); }
+
+			BLEAK_TARGET_SSE static inline vector_t subtract(vector_t lhs, vector_t rhs) noexcept { return _mm_sub_epi8(lhs, rhs); }
+
+			BLEAK_TARGET_SSE static inline vector_t splat(E value) noexcept {
+				if constexpr (sizeof(E) == 1) {
+					return _mm_set1_epi8(static_cast<char>(value));
+				} else {
+					return _mm_set1_epi16(static_cast<short>(value));
+				}
+			}
+
+			// compares sixteen consecutive cells against the splatted value, narrowing to one byte per cell
+			BLEAK_TARGET_SSE static inline vector_t equal(cptr<void> source, vector_t value) noexcept {
+				if constexpr (sizeof(E) == 1) {
+					return _mm_cmpeq_epi8(_mm_loadu_si128(static_cast<const __m128i*>(source)), value);
+				} else {
+					const __m128i lower{ _mm_cmpeq_epi16(_mm_loadu_si128(static_cast<const __m128i*>(source)), value) };
+					const __m128i upper{ _mm_cmpeq_epi16(_mm_loadu_si128(static_cast<const __m128i*>(source) + 1), value) };
+
+					return _mm_packs_epi16(lower, upper);
+				}
+			}
+
+			BLEAK_TARGET_SSE static inline void store(ptr<u8> destination, vector_t value) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), value); }
+
+			BLEAK_TARGET_SSE static inline u32 mask(vector_t value) noexcept { return static_cast<u32>(_mm_movemask_epi8(value)); }
+		};
+
+		template<typename E> struct avx2_ops_t {
+			using vector_t = __m256i;
+
+			static constexpr usize lanes{ 32 };
+
+			BLEAK_TARGET_AVX2 static inline vector_t zero() noexcept { return _mm256_setzero_si256(); }
+
+			BLEAK_TARGET_AVX2 static inline vector_t ones() noexcept { return _mm256_set1_epi8(-1); }
+
+			BLEAK_TARGET_AVX2 static inline vector_t broadcast(u8 value) noexcept { return _mm256_set1_epi8(static_cast<char>(value)); }
+
+			BLEAK_TARGET_AVX2 static inline vector_t bitwise_and(vector_t lhs, vector_t rhs) noexcept { return _mm256_and_si256(lhs, rhs); }
+
+			BLEAK_TARGET_AVX2 static inline vector_t bitwise_or(vector_t lhs, vector_t rhs) noexcept { return _mm256_or_si256(lhs, rhs); }
+
+			BLEAK_TARGET_AVX2 static inline vector_t subtract(vector_t lhs, vector_t rhs) noexcept { return _mm256_sub_epi8(lhs, rhs); }
+
+			BLEAK_TARGET_AVX2 static inline vector_t splat(E value) noexcept {
+				if constexpr (sizeof(E) == 1) {
+					return _mm256_set1_epi8(static_cast<char>(value));
+				} else {
+					return _mm256_set1_epi16(static_cast<short>(value));
+				}
+			}
+
+			// compares thirty-two consecutive cells against the splatted value, narrowing to one byte per cell
+			BLEAK_TARGET_AVX2 static inline vector_t equal(cptr<void> source, vector_t value) noexcept {
+				if constexpr (sizeof(E) == 1) {
+					return _mm256_cmpeq_epi8(_mm256_loadu_si256(static_cast<const __m256i*>(source)), value);
+				} else {
+					const __m256i lower{ _mm256_cmpeq_epi16(_mm256_loadu_si256(static_cast<const __m256i*>(source)), value) };
+					const __m256i upper{ _mm256_cmpeq_epi16(_mm256_loadu_si256(static_cast<const __m256i*>(source) + 1), value) };
+
+					// packing interleaves the 128-bit halves, restore the cell order afterwards
+					return _mm256_permute4x64_epi64(_mm256_packs_epi16(lower, upper), 0xD8);
+				}
+			}
+
+			BLEAK_TARGET_AVX2 static inline void store(ptr<u8> destination, vector_t value) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(destination), value); }
+
+			BLEAK_TARGET_AVX2 static inline u32 mask(vector_t value) noexcept { return static_cast<u32>(_mm256_movemask_epi8(value)); }
+		};
+
+	#define BLEAK_DEFINE_VECTOR_ROW(name, target, ops)                                                                                                \
+		template<kernel_e Kernel, Vectorizable T> target inline usize name(cptr<T> north, cptr<T> central, cptr<T> south, usize width, T value, ptr<u8> out) noexcept { \
+			using element_t = std::conditional<sizeof(T) == 1, u8, u16>::type;                                                                     \
+			using ops_t = ops<element_t>;                                                                                                           \
+			using vector_t = typename ops_t::vector_t;                                                                                              \
+                                                                                                                                                    \
+			const vector_t splatted{ ops_t::splat(std::bit_cast<element_t>(value)) };                                                              \
+			const cptr<T> rows[3]{ north, central, south };                                                                                         \
+                                                                                                                                                    \
+			usize x{ 1 };                                                                                                                           \
+                                                                                                                                                    \
+			for (; x + ops_t::lanes + 1 <= width; x += ops_t::lanes) {                                                                              \
+				vector_t planes[9];                                                                                                                 \
+                                                                                                                                                    \
+				for (usize j{ 0 }; j < 3; ++j) {                                                                                                    \
+					for (usize i{ 0 }; i < 3; ++i) {                                                                                                \
+						planes[j * 3 + i] = rows[j] == nullptr ? ops_t::ones() : ops_t::equal(rows[j] + x + i - 1, splatted);                       \
+					}                                                                                                                               \
+				}                                                                                                                                   \
+                                                                                                                                                    \
+				vector_t result{ ops_t::zero() };                                                                                                   \
+                                                                                                                                                    \
+				if constexpr (Kernel == kernel_e::NeighbourCount) {                                                                                 \
+					for (usize i{ 0 }; i < 9; ++i) {                                                                                                \
+						if (i != 4) {                                                                                                               \
+							result = ops_t::subtract(result, planes[i]);                                                                            \
+						}                                                                                                                           \
+					}                                                                                                                               \
+				} else {                                                                                                                            \
+					for (cauto term : kernel_terms<Kernel>::terms) {                                                                                \
+						const vector_t matches{ ops_t::bitwise_and(ops_t::bitwise_and(planes[term.first], planes[term.second]), planes[term.third]) }; \
+						result = ops_t::bitwise_or(result, ops_t::bitwise_and(matches, ops_t::broadcast(term.bit)));                                \
+					}                                                                                                                               \
+				}                                                                                                                                   \
+                                                                                                                                                    \
+				ops_t::store(out + x, result);                                                                                                      \
+			}                                                                                                                                       \
+                                                                                                                                                    \
+			return x;                                                                                                                               \
+		}
+
+		BLEAK_DEFINE_VECTOR_ROW(sse_row, BLEAK_TARGET_SSE, sse_ops_t)
+		BLEAK_DEFINE_VECTOR_ROW(avx2_row, BLEAK_TARGET_AVX2, avx2_ops_t)
+
+	#undef BLEAK_DEFINE_VECTOR_ROW
+
+	#define BLEAK_DEFINE_VECTOR_SPAN(count_name, find_name, target, ops)                                                                              \
+		template<Vectorizable T> target inline usize count_name(cptr<T> data, usize length, T value, ref<usize> processed) noexcept {              \
+			using element_t = std::conditional<sizeof(T) == 1, u8, u16>::type;                                                                     \
+			using ops_t = ops<element_t>;                                                                                                           \
+                                                                                                                                                    \
+			const typename ops_t::vector_t splatted{ ops_t::splat(std::bit_cast<element_t>(value)) };                                              \
+                                                                                                                                                    \
+			usize total{ 0 };                                                                                                                       \
+			usize x{ 0 };                                                                                                                           \
+                                                                                                                                                    \
+			for (; x + ops_t::lanes <= length; x += ops_t::lanes) {                                                                                 \
+				total += std::popcount(ops_t::mask(ops_t::equal(data + x, splatted)));                                                              \
+			}                                                                                                                                       \
+                                                                                                                                                    \
+			processed = x;                                                                                                                          \
+                                                                                                                                                    \
+			return total;                                                                                                                           \
+		}                                                                                                                                           \
+                                                                                                                                                    \
+		template<Vectorizable T> target inline bool find_name(cptr<T> data, usize length, T value, ref<usize> processed) noexcept {                \
+			using element_t = std::conditional<sizeof(T) == 1, u8, u16>::type;                                                                     \
+			using ops_t = ops<element_t>;                                                                                                           \
+                                                                                                                                                    \
+			const typename ops_t::vector_t splatted{ ops_t::splat(std::bit_cast<element_t>(value)) };                                              \
+                                                                                                                                                    \
+			usize x{ 0 };                                                                                                                           \
+                                                                                                                                                    \
+			for (; x + ops_t::lanes <= length; x += ops_t::lanes) {                                                                                 \
+				if (ops_t::mask(ops_t::equal(data + x, splatted)) != 0) {                                                                           \
+					processed = x;                                                                                                                  \
+					return true;                                                                                                                    \
+				}                                                                                                                                   \
+			}                                                                                                                                       \
+                                                                                                                                                    \
+			processed = x;                                                                                                                          \
+                                                                                                                                                    \
+			return false;                                                                                                                           \
+		}
+
+		BLEAK_DEFINE_VECTOR_SPAN(sse_count, sse_contains, BLEAK_TARGET_SSE, sse_ops_t)
+		BLEAK_DEFINE_VECTOR_SPAN(avx2_count, avx2_contains, BLEAK_TARGET_AVX2, avx2_ops_t)
+
+	#undef BLEAK_DEFINE_VECTOR_SPAN
+#endif
+
+		// evaluates a whole row, dispatching to the widest instruction set available at runtime for vectorizable cell types
+		template<kernel_e Kernel, typename T, typename U>
+			requires is_equatable<T, U>::value
+		inline void row(cptr<T> north, cptr<T> central, cptr<T> south, usize width, cref<U> value, ptr<u8> out) noexcept {
+			if (width == 0) {
+				return;
+			}
+
+			usize first{ 0 };
+			usize last{ 0 };
+
+#if defined(BLEAK_SIMD_X86)
+			if constexpr (is_vectorizable<T>::value && std::is_same<T, U>::value) {
+				switch (detect()) {
+					case isa_e::AVX2: {
+						last = avx2_row<Kernel>(north, central, south, width, value, out);
+						first = 1;
+						break;
+					} case isa_e::SSE: {
+						last = sse_row<Kernel>(north, central, south, width, value, out);
+						first = 1;
+						break;
+					} default: {
+						break;
+					}
+				}
+			}
+#endif
+
+			if (first < last) {
+				scalar_row<Kernel>(north, central, south, width, value, out, 0, first);
+				scalar_row<Kernel>(north, central, south, width, value, out, last, width);
+			} else {
+				scalar_row<Kernel>(north, central, south, width, value, out, 0, width);
+			}
+		}
+
+		// number of cells within [data, data + length) equal to the value
+		template<typename T, typename U>
+			requires is_equatable<T, U>::value
+		inline usize count(cptr<T> data, usize length, cref<U> value) noexcept {
+			usize total{ 0 };
+			usize processed{ 0 };
+
+#if defined(BLEAK_SIMD_X86)
+			if constexpr (is_vectorizable<T>::value && std::is_same<T, U>::value) {
+				switch (detect()) {
+					case isa_e::AVX2: {
+						total = avx2_count(data, length, value, processed);
+						break;
+					} case isa_e::SSE: {
+						total = sse_count(data, length, value, processed);
+						break;
+					} default: {
+						break;
+					}
+				}
+			}
+#endif
+
+			for (usize x{ processed }; x < length; ++x) {
+				if (data[x] == value) {
+					++total;
+				}
+			}
+
+			return total;
+		}
+
+		// whether any cell within [data, data + length) equals the value
+		template<typename T, typename U>
+			requires is_equatable<T, U>::value
+		inline bool contains(cptr<T> data, usize length, cref<U> value) noexcept {
+			usize processed{ 0 };
+
+#if defined(BLEAK_SIMD_X86)
+			if constexpr (is_vectorizable<T>::value && std::is_same<T, U>::value) {
+				switch (detect()) {
+					case isa_e::AVX2: {
+						if (avx2_contains(data, length, value, processed)) {
+							return true;
+						}
+						break;
+					} case isa_e::SSE: {
+						if (sse_contains(data, length, value, processed)) {
+							return true;
+						}
+						break;
+					} default: {
+						break;
+					}
+				}
+			}
+#endif
+
+			for (usize x{ processed }; x < length; ++x) {
+				if (data[x] == value) {
+					return true;
+				}
+			}
+
+			return false;
+		}
+	} // namespace simd
+} // namespace bleak
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <deque>
+#include <memory>
+#include <utility>
+
+#include <bleak/delta.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/log.hpp>
+#include <bleak/zone.hpp>
+
+namespace bleak {
+	// rolling history of zone states for undo and replay; each turn is stored as a delta from the turn before it
+	// a full keyframe is only taken once the deltas since the last one outweigh a copy of the zone, so memory follows the amount of change rather than the size of the map
+	template<typename T, extent_t Size, extent_t BorderSize = extent_t::Zero> struct snapshot_ring_t {
+		using zone_type = zone_t<T, Size, BorderSize>;
+		using delta_type = zone_delta_t<T>;
+
+	  private:
+		struct frame_t {
+			std::unique_ptr<zone_type> keyframe;
+			delta_type delta;
+
+			constexpr bool is_keyframe() const noexcept { return keyframe != nullptr; }
+		};
+
+		usize limit;
+
+		// turn number of the oldest retained frame
+		usize base;
+
+		// delta bytes accumulated since the most recent keyframe
+		usize pending;
+
+		std::deque<frame_t> frames;
+
+		// state of the newest frame, kept so pushes only need to diff
+		zone_type latest;
+
+		constexpr usize index_of(usize turn) const noexcept { return turn - base; }
+
+		// stored states carry no sampler or change tracking of their own
+		static inline std::unique_ptr<zone_type> capture(cref<zone_type> state) noexcept {
+			std::unique_ptr<zone_type> copy{ std::make_unique<zone_type>(state) };
+
+			copy->disable_sampler().disable_tracking();
+
+			return copy;
+		}
+
+		inline void evict() noexcept {
+			if (frames.size() > 1 && !frames[1].is_keyframe()) {
+				// roll the oldest keyframe forward so the next frame can stand on its own
+				frames[0].keyframe->apply_delta(frames[1].delta);
+
+				frames[1].keyframe = std::move(frames[0].keyframe);
+				frames[1].delta = delta_type{};
+			}
+
+			frames.pop_front();
+
+			++base;
+		}
+
+		inline void recount() noexcept {
+			pending = 0;
+
+			for (auto iter{ frames.rbegin() }; iter != frames.rend() && !iter->is_keyframe(); ++iter) {
+				pending += iter->delta.byte_size();
+			}
+		}
+
+	  public:
+		// capacity is the number of turns retained before the oldest are dropped
+		inline snapshot_ring_t(usize capacity) noexcept : limit{ max<usize>(capacity, 1) }, base{ 0 }, pending{ 0 }, frames{}, latest{} {}
+
+		inline snapshot_ring_t(cref<snapshot_ring_t> other) noexcept = delete;
+		inline ref<snapshot_ring_t> operator=(cref<snapshot_ring_t> other) noexcept = delete;
+
+		constexpr usize capacity() const noexcept { return limit; }
+
+		constexpr usize size() const noexcept { return frames.size(); }
+
+		constexpr bool empty() const noexcept { return frames.empty(); }
+
+		constexpr usize oldest() const noexcept { return base; }
+
+		// only meaningful when the ring is not empty
+		constexpr usize newest() const noexcept { return base + frames.size() - 1; }
+
+		constexpr bool contains(usize turn) const noexcept { return !frames.empty() && turn >= base && turn <= newest(); }
+
+		constexpr usize keyframes() const noexcept {
+			usize count{ 0 };
+
+			for (crauto frame : frames) {
+				count += frame.is_keyframe();
+			}
+
+			return count;
+		}
+
+		// bytes held by keyframes and deltas, excluding the working copy of the newest state
+		constexpr usize byte_size() const noexcept {
+			usize total{ 0 };
+
+			for (crauto frame : frames) {
+				total += frame.is_keyframe() ? zone_type::byte_size : frame.delta.byte_size();
+			}
+
+			return total;
+		}
+
+		inline void clear() noexcept {
+			frames.clear();
+
+			base = 0;
+			pending = 0;
+		}
+
+		// records state as the next turn and returns its turn number
+		inline usize push(cref<zone_type> state) noexcept {
+			if (frames.empty()) {
+				frames.push_back(frame_t{ capture(state), delta_type{} });
+
+				latest = *frames.back().keyframe;
+				pending = 0;
+
+				return newest();
+			}
+
+			frame_t frame{ nullptr, latest.diff(state) };
+
+			if (pending + frame.delta.byte_size() > zone_type::byte_size) {
+				frame.keyframe = capture(state);
+				frame.delta = delta_type{};
+
+				pending = 0;
+			} else {
+				frame.delta.shrink();
+
+				pending += frame.delta.byte_size();
+			}
+
+			frames.push_back(std::move(frame));
+
+			latest.apply_delta(frames.back().is_keyframe() ? latest.diff(*frames.back().keyframe) : frames.back().delta);
+
+			while (frames.size() > limit) {
+				evict();
+			}
+
+			return newest();
+		}
+
+		// rebuilds the state of a retained turn into out from the nearest keyframe at or before it
+		// out keeps its own sampler and change tracking, and only the cells that actually change are written
+		inline bool restore(usize turn, ref<zone_type> out) const noexcept {
+			if (!contains(turn)) {
+				error_log.add("turn {} is not retained by the snapshot ring!", turn);
+				return false;
+			}
+
+			usize first{ index_of(turn) };
+
+			while (!frames[first].is_keyframe()) {
+				--first;
+			}
+
+			if (!out.apply_delta(out.diff(*frames[first].keyframe))) {
+				return false;
+			}
+
+			for (usize i{ first + 1 }; i <= index_of(turn); ++i) {
+				if (!out.apply_delta(frames[i].delta)) {
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		// drops the newest turn and writes the turn before it into out; the oldest retained turn cannot be undone
+		inline bool undo(ref<zone_type> out) noexcept {
+			if (frames.size() < 2) {
+				return false;
+			}
+
+			frames.pop_back();
+
+			if (!restore(newest(), latest)) {
+				return false;
+			}
+
+			recount();
+
+			return out.apply_delta(out.diff(latest));
+		}
+
+		// drops every turn after the given one, as when play resumes from a point in the replay
+		inline bool truncate(usize turn) noexcept {
+			if (!contains(turn)) {
+				error_log.add("turn {} is not retained by the snapshot ring!", turn);
+				return false;
+			}
+
+			frames.resize(index_of(turn) + 1);
+
+			recount();
+
+			return restore(turn, latest);
+		}
+	};
+} // namespace bleak
@@ -0,0 +1,272 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+#include <bleak/array.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/utility.hpp>
+
+namespace bleak {
+	enum struct boundary_e : u8 {
+		// neighbours beyond the array match any value, as with the unsafe neighbour_count and calculate_index
+		Match,
+		// neighbours beyond the array never match
+		Ignore,
+		// neighbours beyond the array read the nearest cell within it
+		Clamp
+	};
+
+	// offsets of the cells a kernel reads around the cell it writes, in the order their bits appear in an index from most to least significant
+	template<usize N> struct neighbourhood_t {
+		static constexpr usize size{ N };
+
+		std::array<offset_t, N> offsets;
+
+		constexpr offset_t::scalar_t radius() const noexcept {
+			offset_t::scalar_t radius{ 0 };
+
+			for (crauto offset : offsets) {
+				radius = max<offset_t::scalar_t>(radius, max<offset_t::scalar_t>(offset.x < 0 ? -offset.x : offset.x, offset.y < 0 ? -offset.y : offset.y));
+			}
+
+			return radius;
+		}
+	};
+
+	namespace neighbourhood {
+		// reads nothing but the cell itself
+		constexpr neighbourhood_t<0> Pointwise{};
+
+		// same order as calculate_index<solver_e::Moore>
+		constexpr neighbourhood_t<8> Moore{ { offset_t::Northwest, offset_t::North, offset_t::Northeast, offset_t::West, offset_t::East, offset_t::Southwest, offset_t::South, offset_t::Southeast } };
+
+		// same order as calculate_index<solver_e::VonNeumann>
+		constexpr neighbourhood_t<4> VonNeumann{ { offset_t::North, offset_t::West, offset_t::East, offset_t::South } };
+	} // namespace neighbourhood
+
+	// the neighbours of one cell as seen by a kernel; neighbours beyond the array are null unless the boundary clamps
+	template<typename T, usize N, boundary_e Boundary> struct window_t {
+		offset_t position;
+
+		cptr<T> centre;
+
+		std::array<cptr<T>, N> neighbours;
+
+		constexpr cref<T> operator*() const noexcept { return *centre; }
+
+		constexpr bool outside(usize i) const noexcept { return neighbours[i] == nullptr; }
+
+		template<typename U> constexpr bool matches(usize i, cref<U> value) const noexcept {
+			if (neighbours[i] == nullptr) {
+				return Boundary == boundary_e::Match;
+			}
+
+			return *neighbours[i] == value;
+		}
+
+		template<typename U> constexpr u32 count(cref<U> value) const noexcept {
+			u32 count{ 0 };
+
+			for (usize i{ 0 }; i < N; ++i) {
+				count += matches(i, value);
+			}
+
+			return count;
+		}
+
+		// one bit per neighbour, the first offset of the neighbourhood being the most significant
+		template<typename U> constexpr u64 index(cref<U> value) const noexcept {
+			static_assert(N <= 64, "neighbourhood is too large to index!");
+
+			u64 index{ 0 };
+
+			for (usize i{ 0 }; i < N; ++i) {
+				index = (index << 1) | static_cast<u64>(matches(i, value));
+			}
+
+			return index;
+		}
+	};
+
+	// a kernel names the neighbourhood it reads and is invoked as kernel(window, value), where value holds the cell as left by the kernels before it
+	template<typename Kernel> concept StencilKernel = requires { Kernel::neighbourhood.offsets; };
+
+	namespace stencil {
+		template<typename Kernel> constexpr offset_t::scalar_t radius_of() noexcept { return Kernel::neighbourhood.radius(); }
+
+		template<typename... Kernels> constexpr offset_t::scalar_t radius() noexcept {
+			offset_t::scalar_t radius{ 0 };
+
+			((radius = max<offset_t::scalar_t>(radius, radius_of<Kernels>())), ...);
+
+			return radius;
+		}
+
+		// storage distances from a cell to each of its neighbours within a row-major array, folded at compile time
+		template<typename Kernel, extent_t::scalar_t Width> struct strides {
+			static constexpr usize size{ Kernel::neighbourhood.size };
+
+			static constexpr std::array<isize, size> value{ []() {
+				std::array<isize, size> value{};
+
+				for (usize i{ 0 }; i < size; ++i) {
+					value[i] = static_cast<isize>(Kernel::neighbourhood.offsets[i].y) * Width + Kernel::neighbourhood.offsets[i].x;
+				}
+
+				return value;
+			}() };
+		};
+
+		// neighbours of a cell at least the neighbourhood's radius away from every edge
+		template<boundary_e Boundary, typename Kernel, typename T, extent_t Size, storage_e Storage, layout_e Layout>
+		constexpr window_t<T, Kernel::neighbourhood.size, Boundary> gather_interior(cref<array_t<T, Size, Storage, Layout>> source, offset_t position) noexcept {
+			constexpr usize N{ Kernel::neighbourhood.size };
+
+			window_t<T, N, Boundary> window{ position, &source[position], {} };
+
+			if constexpr (Layout == layout_e::RowMajor) {
+				for (usize i{ 0 }; i < N; ++i) {
+					window.neighbours[i] = window.centre + strides<Kernel, Size.w>::value[i];
+				}
+			} else {
+				for (usize i{ 0 }; i < N; ++i) {
+					window.neighbours[i] = &source[position + Kernel::neighbourhood.offsets[i]];
+				}
+			}
+
+			return window;
+		}
+
+		// neighbours of a cell near an edge, resolving those beyond the array according to the boundary
+		template<boundary_e Boundary, typename Kernel, typename T, extent_t Size, storage_e Storage, layout_e Layout>
+		constexpr window_t<T, Kernel::neighbourhood.size, Boundary> gather_edge(cref<array_t<T, Size, Storage, Layout>> source, offset_t position) noexcept {
+			constexpr usize N{ Kernel::neighbourhood.size };
+
+			window_t<T, N, Boundary> window{ position, &source[position], {} };
+
+			for (usize i{ 0 }; i < N; ++i) {
+				const offset_t neighbour{ position + Kernel::neighbourhood.offsets[i] };
+
+				if (neighbour.x >= 0 && neighbour.y >= 0 && neighbour.x < Size.w && neighbour.y < Size.h) {
+					window.neighbours[i] = &source[neighbour];
+				} else if constexpr (Boundary == boundary_e::Clamp) {
+					window.neighbours[i] = &source[clamp<offset_t::scalar_t>(neighbour.x, 0, Size.w - 1), clamp<offset_t::scalar_t>(neighbour.y, 0, Size.h - 1)];
+				} else {
+					window.neighbours[i] = nullptr;
+				}
+			}
+
+			return window;
+		}
+
+		template<bool Interior, boundary_e Boundary, typename T, extent_t Size, storage_e Storage, layout_e Layout, typename... Kernels>
+		constexpr void evaluate(cref<array_t<T, Size, Storage, Layout>> source, ref<array_t<T, Size, Storage, Layout>> destination, offset_t position, cref<Kernels>... kernels) noexcept {
+			T value{ source[position] };
+
+			if constexpr (Interior) {
+				(kernels(gather_interior<Boundary, Kernels>(source, position), value), ...);
+			} else {
+				(kernels(gather_edge<Boundary, Kernels>(source, position), value), ...);
+			}
+
+			destination[position] = std::move(value);
+		}
+
+		// runs every kernel over each cell of the inclusive rectangle [first, last] of source in a single pass, writing the result to destination
+		// all kernels read the same source generation and each receives the value left by the kernels before it, so pointwise follow-ups and independent neighbourhood rules fuse into one pass
+		// cells far enough from the edges for every kernel's neighbourhood take a branch-free path; only the rest resolve the boundary
+		template<boundary_e Boundary = boundary_e::Match, typename T, extent_t Size, storage_e Storage, layout_e Layout, StencilKernel... Kernels>
+		constexpr void apply(cref<array_t<T, Size, Storage, Layout>> source, ref<array_t<T, Size, Storage, Layout>> destination, offset_t first, offset_t last, cref<Kernels>... kernels) noexcept {
+			constexpr offset_t::scalar_t reach{ radius<Kernels...>() };
+
+			const offset_t::scalar_t left{ max<offset_t::scalar_t>(first.x, 0) };
+			const offset_t::scalar_t right{ min<offset_t::scalar_t>(last.x, Size.w - 1) };
+
+			const offset_t::scalar_t inner_left{ max<offset_t::scalar_t>(left, reach) };
+			const offset_t::scalar_t inner_right{ min<offset_t::scalar_t>(right, Size.w - 1 - reach) };
+
+			for (offset_t::scalar_t y{ max<offset_t::scalar_t>(first.y, 0) }; y <= min<offset_t::scalar_t>(last.y, Size.h - 1); ++y) {
+				if (y < reach || y > Size.h - 1 - reach || inner_left > inner_right) {
+					for (offset_t::scalar_t x{ left }; x <= right; ++x) {
+						evaluate<false, Boundary>(source, destination, offset_t{ x, y }, kernels...);
+					}
+
+					continue;
+				}
+
+				for (offset_t::scalar_t x{ left }; x < inner_left; ++x) {
+					evaluate<false, Boundary>(source, destination, offset_t{ x, y }, kernels...);
+				}
+
+				for (offset_t::scalar_t x{ inner_left }; x <= inner_right; ++x) {
+					evaluate<true, Boundary>(source, destination, offset_t{ x, y }, kernels...);
+				}
+
+				for (offset_t::scalar_t x{ inner_right + 1 }; x <= right; ++x) {
+					evaluate<false, Boundary>(source, destination, offset_t{ x, y }, kernels...);
+				}
+			}
+		}
+
+		// writes the cell to itself; useful to carry cells through a fused pass unchanged
+		template<typename T> struct identity_t {
+			static constexpr neighbourhood_t<0> neighbourhood{ neighbourhood::Pointwise };
+
+			template<typename Window> constexpr void operator()(cref<Window> window, ref<T> value) const noexcept {}
+		};
+
+		// replaces every cell equal to from with to
+		template<typename T> struct replace_t {
+			static constexpr neighbourhood_t<0> neighbourhood{ neighbourhood::Pointwise };
+
+			T from;
+			T to;
+
+			template<typename Window> constexpr void operator()(cref<Window> window, ref<T> value) const noexcept {
+				if (value == from) {
+					value = to;
+				}
+			}
+		};
+
+		// cellular automaton step matching a single automatize pass, except that cells at the threshold keep their current value
+		template<typename T> struct modulate_t {
+			static constexpr neighbourhood_t<8> neighbourhood{ neighbourhood::Moore };
+
+			u8 threshold;
+
+			T true_value;
+			T false_value;
+
+			template<typename Window> constexpr void operator()(cref<Window> window, ref<T> value) const noexcept {
+				const u32 neighbours{ window.count(true_value) };
+
+				if (neighbours > threshold) {
+					value = true_value;
+				} else if (neighbours < threshold) {
+					value = false_value;
+				}
+			}
+		};
+
+		// replaces cells equal to value whose neighbourhood index of value equals index, as collapse does for its solver
+		template<typename T, auto Neighbourhood = neighbourhood::Moore> struct collapse_t {
+			static constexpr decltype(Neighbourhood) neighbourhood{ Neighbourhood };
+
+			T value;
+			u64 index;
+			T collapse_to;
+
+			template<typename Window> constexpr void operator()(cref<Window> window, ref<T> cell) const noexcept {
+				if (cell == value && window.index(value) == index) {
+					cell = collapse_to;
+				}
+			}
+		};
+	} // namespace stencil
+} // namespace bleak
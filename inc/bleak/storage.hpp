@@ -0,0 +1,188 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <utility>
+
+#if defined(__linux__)
+	#include <sys/mman.h>
+#endif
+
+#include <bleak/extent.hpp>
+#include <bleak/log.hpp>
+#include <bleak/utility.hpp>
+
+namespace bleak {
+	enum struct storage_e : u8 {
+		// elements live inside the owning object
+		Inline,
+		// elements live in a cache line aligned heap allocation
+		Heap,
+		// elements live in a huge page aligned heap allocation which the kernel is advised to back with huge pages where supported
+		Huge
+	};
+
+	// storage chosen by array_t when none is named; specialize to move a particular cell type or size onto huge pages
+	template<typename T, extent_t Size> struct storage_policy {
+		static constexpr storage_e value{ static_cast<usize>(Size.area()) * sizeof(T) > memory::InlineLimit ? storage_e::Heap : storage_e::Inline };
+	};
+
+	template<typename T, usize Area, storage_e Storage> struct storage_t;
+
+	template<typename T, usize Area> struct storage_t<T, Area, storage_e::Inline> {
+	  private:
+		std::array<T, Area> elements;
+
+	  public:
+		static_assert(Area * sizeof(T) <= memory::Maximum, "inline storage must not exceed the maximum!");
+
+		inline constexpr storage_t() noexcept : elements{} {}
+
+		inline constexpr storage_t(cref<storage_t> other) noexcept : elements{ other.elements } {}
+
+		inline constexpr storage_t(rval<storage_t> other) noexcept : elements{ std::move(other.elements) } {}
+
+		inline constexpr ref<storage_t> operator=(cref<storage_t> other) noexcept {
+			if (this != &other) {
+				elements = other.elements;
+			}
+
+			return *this;
+		}
+
+		inline constexpr ref<storage_t> operator=(rval<storage_t> other) noexcept {
+			if (this != &other) {
+				elements = std::move(other.elements);
+			}
+
+			return *this;
+		}
+
+		inline constexpr ~storage_t() noexcept {}
+
+		inline constexpr ptr<T> data() noexcept { return elements.data(); }
+
+		inline constexpr cptr<T> data() const noexcept { return elements.data(); }
+
+		inline constexpr ref<T> operator[](usize index) noexcept { return elements[index]; }
+
+		inline constexpr cref<T> operator[](usize index) const noexcept { return elements[index]; }
+	};
+
+	// heap storage keeps value semantics; moves hand the allocation over instead of copying elements
+	// a storage moved from by construction holds no elements and may only be assigned to or destroyed; copying one yields value initialized elements
+	// failing to allocate is fatal, so every storage that was not moved from holds its elements
+	template<typename T, usize Area, storage_e Storage>
+		requires(Storage == storage_e::Heap || Storage == storage_e::Huge)
+	struct storage_t<T, Area, Storage> {
+		static constexpr usize alignment{ max<usize>(Storage == storage_e::Huge ? memory::HugePage : memory::CacheLine, alignof(T)) };
+
+		// huge page allocations are rounded up to whole pages so the advice covers the entire range
+		static constexpr usize byte_size{ (Area * sizeof(T) + alignment - 1) / alignment * alignment };
+
+	  private:
+		ptr<T> elements;
+
+		static inline ptr<T> allocate() noexcept {
+			ptr<T> allocation{ static_cast<ptr<T>>(::operator new(byte_size, std::align_val_t{ alignment }, std::nothrow)) };
+
+			if (allocation == nullptr) {
+				error_log.add("failed to allocate {} bytes of array storage!", byte_size);
+				error_log.flush_to_console(std::cerr);
+
+				std::abort();
+			}
+
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+			if constexpr (Storage == storage_e::Huge) {
+				madvise(allocation, byte_size, MADV_HUGEPAGE);
+			}
+#endif
+
+			std::uninitialized_value_construct_n(allocation, Area);
+
+			return allocation;
+		}
+
+		static inline void deallocate(ptr<T> allocation) noexcept {
+			if (allocation == nullptr) {
+				return;
+			}
+
+			std::destroy_n(allocation, Area);
+
+			::operator delete(allocation, std::align_val_t{ alignment });
+		}
+
+	  public:
+		inline storage_t() noexcept : elements{ allocate() } {}
+
+		inline storage_t(cref<storage_t> other) noexcept : elements{ allocate() } {
+			if (other.elements != nullptr) {
+				std::copy_n(other.elements, Area, elements);
+			}
+		}
+
+		inline storage_t(rval<storage_t> other) noexcept : elements{ std::exchange(other.elements, nullptr) } {}
+
+		inline ref<storage_t> operator=(cref<storage_t> other) noexcept {
+			if (this == &other) {
+				return *this;
+			}
+
+			if (elements == nullptr) {
+				elements = allocate();
+			}
+
+			// copying a storage that was moved from resets to value initialized elements, as copy construction does
+			if (other.elements == nullptr) {
+				std::fill_n(elements, Area, T{});
+			} else {
+				std::copy_n(other.elements, Area, elements);
+			}
+
+			return *this;
+		}
+
+		inline ref<storage_t> operator=(rval<storage_t> other) noexcept {
+			if (this != &other) {
+				std::swap(elements, other.elements);
+			}
+
+			return *this;
+		}
+
+		inline ~storage_t() noexcept { deallocate(elements); }
+
+		inline ptr<T> data() noexcept {
+			assert(elements != nullptr);
+
+			return elements;
+		}
+
+		inline cptr<T> data() const noexcept {
+			assert(elements != nullptr);
+
+			return elements;
+		}
+
+		inline ref<T> operator[](usize index) noexcept {
+			assert(elements != nullptr && index < Area);
+
+			return elements[index];
+		}
+
+		inline cref<T> operator[](usize index) const noexcept {
+			assert(elements != nullptr && index < Area);
+
+			return elements[index];
+		}
+	};
+} // namespace bleak
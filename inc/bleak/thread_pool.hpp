@@ -0,0 +1,135 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <condition_variable>
+#include <functional>
+#include <latch>
+#include <mutex>
+#include <queue>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+#include <bleak/concepts.hpp>
+#include <bleak/utility.hpp>
+
+namespace bleak {
+	struct thread_pool_t {
+	  private:
+		std::vector<std::jthread> workers;
+		std::queue<std::function<void()>> tasks;
+
+		std::mutex access;
+		std::condition_variable_any signal;
+
+		inline void work(std::stop_token token) noexcept {
+			while (true) {
+				std::function<void()> task{};
+
+				{
+					std::unique_lock<std::mutex> lock{ access };
+
+					if (!signal.wait(lock, token, [this]() -> bool { return !tasks.empty(); })) {
+						return;
+					}
+
+					task = std::move(tasks.front());
+					tasks.pop();
+				}
+
+				task();
+			}
+		}
+
+	  public:
+		static inline usize default_concurrency() noexcept {
+			const usize concurrency{ std::thread::hardware_concurrency() };
+
+			return concurrency > 1 ? concurrency - 1 : 1;
+		}
+
+		inline thread_pool_t() noexcept : thread_pool_t{ default_concurrency() } {}
+
+		inline explicit thread_pool_t(usize count) noexcept : workers{}, tasks{}, access{}, signal{} {
+			workers.reserve(count);
+
+			for (usize i{ 0 }; i < count; ++i) {
+				workers.emplace_back([this](std::stop_token token) { work(token); });
+			}
+		}
+
+		inline thread_pool_t(cref<thread_pool_t> other) noexcept = delete;
+		inline ref<thread_pool_t> operator=(cref<thread_pool_t> other) noexcept = delete;
+
+		inline ~thread_pool_t() noexcept {
+			for (auto& worker : workers) {
+				worker.request_stop();
+			}
+
+			signal.notify_all();
+
+			// joined here rather than by the member destructor, as workers is destroyed last and the workers still wait on signal and lock access
+			workers.clear();
+		}
+
+		// number of worker threads, not counting the calling thread which also takes part in parallel_for
+		inline usize size() const noexcept { return workers.size(); }
+
+		inline void submit(rval<std::function<void()>> task) noexcept {
+			{
+				std::lock_guard<std::mutex> lock{ access };
+
+				tasks.push(std::move(task));
+			}
+
+			signal.notify_one();
+		}
+
+		// splits [first, last) into contiguous bands of at least grain elements and invokes func(band_first, band_last) for each, returning once every band has completed
+		template<typename Func>
+			requires std::is_invocable<Func, isize, isize>::value
+		inline void parallel_for(isize first, isize last, isize grain, cref<Func> func) noexcept {
+			if (first >= last) {
+				return;
+			}
+
+			const isize length{ last - first };
+			const isize max_bands{ max<isize>(length / max<isize>(grain, 1), 1) };
+			const isize bands{ min<isize>(static_cast<isize>(size()) + 1, max_bands) };
+
+			if (bands <= 1) {
+				func(first, last);
+				return;
+			}
+
+			const isize stride{ length / bands };
+			const isize remainder{ length % bands };
+
+			std::latch barrier{ bands - 1 };
+
+			isize band_first{ first };
+
+			for (isize i{ 0 }; i < bands - 1; ++i) {
+				const isize band_last{ band_first + stride + (i < remainder ? 1 : 0) };
+
+				submit([&func, &barrier, band_first, band_last]() {
+					func(band_first, band_last);
+					barrier.count_down();
+				});
+
+				band_first = band_last;
+			}
+
+			func(band_first, last);
+
+			barrier.wait();
+		}
+
+		template<typename Func>
+			requires std::is_invocable<Func, isize, isize>::value
+		inline void parallel_for(isize first, isize last, cref<Func> func) noexcept {
+			parallel_for(first, last, 1, func);
+		}
+	};
+} // namespace bleak
@@ -104,6 +104,12 @@ namespace bleak {
 		constexpr const usize Limit{ usize{ 0 } - 1 };
 		// size in bytes of the maximum size of an array
 		constexpr const usize Maximum{ Gigabyte * 4 };
+		// size in bytes above which arrays move their elements to the heap by default
+		constexpr const usize InlineLimit{ Megabyte };
+		// alignment in bytes of heap-backed array storage; one cache line
+		constexpr const usize CacheLine{ Byte * 64 };
+		// alignment in bytes of huge page backed array storage
+		constexpr const usize HugePage{ Megabyte * 2 };
 	}; // namespace memory
 
 // forces the use of a macro to be terminated with a semicolon
@@ -2,28 +2,44 @@
 
 #include <bleak/typedef.hpp>
 
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <memory>
 #include <optional>
 #include <random>
 #include <string>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <bleak/applicator.hpp>
 #include <bleak/array.hpp>
 #include <bleak/atlas.hpp>
+#include <bleak/bitboard.hpp>
 #include <bleak/camera.hpp>
 #include <bleak/cardinal.hpp>
+#include <bleak/codec.hpp>
 #include <bleak/concepts.hpp>
 #include <bleak/creeper.hpp>
+#include <bleak/delta.hpp>
+#include <bleak/dirty.hpp>
 #include <bleak/extent.hpp>
 #include <bleak/log.hpp>
+#include <bleak/noise.hpp>
 #include <bleak/octant.hpp>
 #include <bleak/offset.hpp>
 #include <bleak/primitive.hpp>
 #include <bleak/random.hpp>
 #include <bleak/renderer.hpp>
+#include <bleak/sampler.hpp>
+#include <bleak/simd.hpp>
+#include <bleak/stencil.hpp>
+#include <bleak/thread_pool.hpp>
+#include <bleak/zone_span.hpp>
 
 #include <bleak/constants/numeric.hpp>
 
@@ -52,6 +68,10 @@ namespace bleak {
 	  private:
 		array_t<T, Size> cells;
 
+		std::unique_ptr<sampler_t<T, Size, BorderSize>> sampler;
+
+		std::unique_ptr<dirty_t<Size>> tracker;
+
 	  public:
 		static constexpr extent_t zone_size{ Size };
 		static constexpr extent_t border_size{ BorderSize };		
@@ -73,9 +93,14 @@ namespace bleak {
 
 		static constexpr bool interior_safe{ border_size.w > 0 && border_size.h > 0 };
 
-		constexpr zone_t() : cells{} {}
+		// cells are addressed through the layout of their array; row spans and row kernels are only contiguous when it is row-major
+		static constexpr layout_e layout{ array_t<T, Size>::layout };
+
+		static constexpr bool row_major{ layout == layout_e::RowMajor };
+
+		constexpr zone_t() : cells{}, sampler{}, tracker{} {}
 
-		constexpr zone_t(cref<std::string> path) : cells{} {
+		constexpr zone_t(cref<std::string> path) : cells{}, sampler{}, tracker{} {
 			std::ifstream file{};
 
 			file.open(path, std::ios::in | std::ios::binary);
@@ -93,13 +118,18 @@ namespace bleak {
 			file.close();
 		}
 
-		constexpr zone_t(cref<zone_t<T, Size, BorderSize>> other) : cells{ other.cells } {};
+		constexpr zone_t(cref<zone_t<T, Size, BorderSize>> other) :
+			cells{ other.cells },
+			sampler{ other.sampler ? std::make_unique<sampler_t<T, Size, BorderSize>>(*other.sampler) : nullptr },
+			tracker{ other.tracker ? std::make_unique<dirty_t<Size>>(*other.tracker) : nullptr } {};
 
-		constexpr zone_t(rval<zone_t<T, Size, BorderSize>> other) : cells{ std::move(other.cells) } {}
+		constexpr zone_t(rval<zone_t<T, Size, BorderSize>> other) : cells{ std::move(other.cells) }, sampler{ std::move(other.sampler) }, tracker{ std::move(other.tracker) } {}
 
 		constexpr ref<zone_t<T, Size, BorderSize>> operator=(cref<zone_t<T, Size, BorderSize>> other) noexcept {
 			if (this != &other) {
 				cells = other.cells;
+				sampler = other.sampler ? std::make_unique<sampler_t<T, Size, BorderSize>>(*other.sampler) : nullptr;
+				tracker = other.tracker ? std::make_unique<dirty_t<Size>>(*other.tracker) : nullptr;
 			}
 
 			return *this;
@@ -108,6 +138,8 @@ namespace bleak {
 		constexpr ref<zone_t<T, Size, BorderSize>> operator=(rval<zone_t<T, Size, BorderSize>> other) noexcept {
 			if (this != &other) {
 				cells = std::move(other.cells);
+				sampler = std::move(other.sampler);
+				tracker = std::move(other.tracker);
 			}
 
 			return *this;
@@ -130,6 +162,8 @@ namespace bleak {
 		}
 
 		constexpr array_t<ref<T>, Size> proxy() noexcept {
+			expose();
+
 			array_t<ref<T>, Size> proxy{};
 
 			for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
@@ -149,19 +183,125 @@ namespace bleak {
 			return proxy;
 		}
 
-		constexpr ref<T> operator[](extent_t::product_t index) noexcept { return cells[index]; }
+		// non-owning counterparts of view and proxy over the zone or a rectangle of it clipped to the zone; only available for row-major layouts
+		constexpr zone_span_t<const T> span() const noexcept
+			requires row_major
+		{
+			return cells.span();
+		}
+
+		constexpr zone_span_t<const T> span(offset_t origin, extent_t size) const noexcept
+			requires row_major
+		{
+			return cells.span(origin, size);
+		}
+
+		constexpr zone_span_t<const T> span(cref<rect_t> bounds) const noexcept
+			requires row_major
+		{
+			return cells.span(bounds.position, bounds.size);
+		}
+
+		// writes through a mutable span cannot be observed, so its rectangle is marked dirty and the sampler invalidated up front
+		// a consumer clearing its tiles or a refresh of the sampler while the span is still being written would miss the later writes, so hand such spans back through commit
+		constexpr zone_span_t<T> span() noexcept
+			requires row_major
+		{
+			expose();
+
+			return cells.span();
+		}
+
+		constexpr zone_span_t<T> span(offset_t origin, extent_t size) noexcept
+			requires row_major
+		{
+			const zone_span_t<T> cells_span{ cells.span(origin, size) };
+
+			if (cells_span.empty()) {
+				return cells_span;
+			}
+
+			if (sampler) {
+				sampler->invalidate();
+			}
+
+			mark_dirty(cells_span.bounds().origin(), cells_span.bounds().extent());
+
+			return cells_span;
+		}
+
+		constexpr zone_span_t<T> span(cref<rect_t> bounds) noexcept
+			requires row_major
+		{
+			return span(bounds.position, bounds.size);
+		}
+
+		// marks the rectangle of a span dirty once more and stales the sampler again, now that the writes through it are done
+		constexpr ref<zone_t<T, Size, BorderSize>> commit(cref<zone_span_t<T>> written) noexcept
+			requires row_major
+		{
+			if (written.empty()) {
+				return *this;
+			}
+
+			if (sampler) {
+				sampler->invalidate();
+			}
+
+			mark_dirty(written.bounds().origin(), written.bounds().extent());
+
+			return *this;
+		}
+
+		// a mutable subscript cannot tell a read from a write, so it marks its tile and stales the sampler either way; the next find_random on the mutable zone rebuilds it
+		// reads of a zone held mutably should go through std::as_const or another constant path so consumers do not repack tiles that never changed
+		constexpr ref<T> operator[](extent_t::product_t index) noexcept {
+			if (sampler) {
+				sampler->invalidate();
+			}
+
+			if (tracker) {
+				tracker->mark(array_t<T, Size>::unflatten(static_cast<usize>(index)));
+			}
+
+			return cells[index];
+		}
 
 		constexpr cref<T> operator[](extent_t::product_t index) const noexcept { return cells[index]; }
 
-		constexpr ref<T> operator[](extent_t::scalar_t x, extent_t::scalar_t y) noexcept { return cells[x, y]; }
+		constexpr ref<T> operator[](extent_t::scalar_t x, extent_t::scalar_t y) noexcept {
+			if (sampler) {
+				sampler->invalidate();
+			}
+
+			if (tracker) {
+				tracker->mark(offset_t{ x, y });
+			}
+
+			return cells[x, y];
+		}
 
 		constexpr cref<T> operator[](extent_t::scalar_t x, extent_t::scalar_t y) const noexcept { return cells[x, y]; }
 
-		constexpr ref<T> operator[](offset_t position) noexcept { return cells[position]; }
+		constexpr ref<T> operator[](offset_t position) noexcept {
+			if (sampler) {
+				sampler->invalidate();
+			}
+
+			if (tracker) {
+				tracker->mark(position);
+			}
+
+			return cells[position];
+		}
 
 		constexpr cref<T> operator[](offset_t position) const noexcept { return cells[position]; }
 
-		constexpr array_t<T, Size>::iterator begin() noexcept { return cells.begin(); }
+		constexpr array_t<T, Size>::iterator begin() noexcept {
+			expose();
+
+			return cells.begin();
+		}
 
 		constexpr array_t<T, Size>::const_iterator begin() const noexcept { return cells.begin(); }
 
@@ -173,7 +313,11 @@ namespace bleak {
 
 		constexpr array_t<T, Size>::const_iterator cend() const noexcept { return cells.cend(); }
 
-		constexpr array_t<T, Size>::reverse_iterator rbegin() noexcept { return cells.rbegin(); }
+		constexpr array_t<T, Size>::reverse_iterator rbegin() noexcept {
+			expose();
+
+			return cells.rbegin();
+		}
 
 		constexpr array_t<T, Size>::reverse_iterator rend() noexcept { return cells.rend(); }
 
@@ -225,6 +369,260 @@ namespace bleak {
 			return false;
 		}
 
+	  private:
+		// called once a bulk mutator has written its cells; the sampler is only marked stale, as generators swap buffers every iteration and a rebuild per swap would cost a pass over the zone each
+		constexpr void touch() noexcept {
+			if (sampler) {
+				sampler->invalidate();
+			}
+
+			mark_dirty();
+		}
+
+		// called before handing out mutable access whose writes cannot be observed; the sampler stays stale until the next mutable query or refresh_sampler
+		constexpr void expose() noexcept {
+			if (sampler) {
+				sampler->invalidate();
+			}
+
+			mark_dirty();
+		}
+
+		template<typename U> constexpr void assign(offset_t position, cref<U> value) noexcept {
+			if (tracker) {
+				tracker->mark(position);
+			}
+
+			if (!sampler) {
+				cells[position] = value;
+
+				return;
+			}
+
+			const T previous{ cells[position] };
+
+			cells[position] = value;
+
+			sampler->update(position, previous, cells[position]);
+		}
+
+		// the sampler only when it is enabled and current; constant queries never rebuild it, as concurrent queries would race on the rebuild, and fall back to scanning instead
+		inline cptr<sampler_t<T, Size, BorderSize>> current_sampler() const noexcept { return sampler && !sampler->is_stale() ? sampler.get() : nullptr; }
+
+		// rebuilds a stale sampler ahead of a query made through the mutable zone, the one place a rebuild cannot race with other queries
+		inline void prepare_sampler() noexcept {
+			if (sampler && sampler->is_stale()) {
+				sampler->rebuild(cells);
+			}
+		}
+
+		// invokes func(data, length) over the contiguous row spans making up the region until it returns true
+		template<zone_region_e Region, typename Func>
+			requires std::is_invocable_r<bool, Func, cptr<T>, usize>::value
+		inline bool for_each_span(cref<Func> func) const noexcept {
+			if constexpr (Region == zone_region_e::All) {
+				return func(cells.data_ptr(), static_cast<usize>(zone_area));
+			} else if constexpr (!row_major) {
+				// rows are scattered across storage so every cell of the region is its own span; membership mirrors the row-major spans below
+				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+					for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+						const bool border_cell{ y < interior_origin.y || y > interior_extent.y || x < border_size.w || x >= zone_size.w - border_size.w };
+
+						if ((Region == zone_region_e::Interior ? within<Region>(offset_t{ x, y }) : border_cell) && func(&cells[x, y], 1)) {
+							return true;
+						}
+					}
+				}
+
+				return false;
+			} else if constexpr (Region == zone_region_e::Interior) {
+				const usize length{ static_cast<usize>(interior_extent.x - interior_origin.x + 1) };
+
+				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
+					if (func(row_ptr(y) + interior_origin.x, length)) {
+						return true;
+					}
+				}
+
+				return false;
+			} else if constexpr (Region == zone_region_e::Border) {
+				const usize length{ static_cast<usize>(border_size.w) };
+
+				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+					if (y < interior_origin.y || y > interior_extent.y) {
+						if (func(row_ptr(y), static_cast<usize>(zone_size.w))) {
+							return true;
+						}
+					} else if (func(row_ptr(y), length) || func(row_ptr(y) + zone_size.w - border_size.w, length)) {
+						return true;
+					}
+				}
+
+				return false;
+			} else {
+				return false;
+			}
+		}
+
+		template<zone_region_e Region, typename U>
+			requires is_equatable<T, U>::value
+		inline u32 count_spans(cref<U> value) const noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return 0;
+			} else {
+				// the sampler splits cells at the interior bounds whereas the border loops also claim the last interior column
+				if constexpr (Region != zone_region_e::Border) {
+					if (cptr<sampler_t<T, Size, BorderSize>> index{ current_sampler() }; index != nullptr) {
+						return static_cast<u32>(index->count(value, samples_interior<Region>(), samples_border<Region>()));
+					}
+				}
+
+				usize total{ 0 };
+
+				for_each_span<Region>([&](cptr<T> data, usize length) -> bool {
+					total += simd::count(data, length, value);
+
+					return false;
+				});
+
+				return static_cast<u32>(total);
+			}
+		}
+
+		template<zone_region_e Region, typename U>
+			requires is_equatable<T, U>::value
+		inline u32 contains_spans(cref<U> value) const noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return false;
+			} else {
+				if constexpr (Region != zone_region_e::Border) {
+					if (cptr<sampler_t<T, Size, BorderSize>> index{ current_sampler() }; index != nullptr) {
+						return index->count(value, samples_interior<Region>(), samples_border<Region>()) > 0;
+					}
+				}
+
+				return for_each_span<Region>([&](cptr<T> data, usize length) -> bool { return simd::contains(data, length, value); });
+			}
+		}
+
+		template<zone_region_e Region> static constexpr bool samples_interior() noexcept { return Region == zone_region_e::All || Region == zone_region_e::Interior; }
+
+		template<zone_region_e Region> static constexpr bool samples_border() noexcept { return Region == zone_region_e::All || Region == zone_region_e::Border; }
+
+	  public:
+		// the sampler indexes cells by value for constant time find_random; single cell set, apply and repeal keep it current
+		// bulk mutators mark it stale, as do mutable subscripts, spans, iterators and proxies since their writes cannot be observed, and find_random on the mutable zone rebuilds it once before sampling
+		// constant queries cannot rebuild it and scan while it is stale, which is_sampler_current reports; refresh_sampler rebuilds it ahead of such queries
+		inline ref<zone_t<T, Size, BorderSize>> enable_sampler() noexcept {
+			if (!sampler) {
+				sampler = std::make_unique<sampler_t<T, Size, BorderSize>>(cells);
+			}
+
+			return *this;
+		}
+
+		inline ref<zone_t<T, Size, BorderSize>> disable_sampler() noexcept {
+			sampler.reset();
+
+			return *this;
+		}
+
+		constexpr bool has_sampler() const noexcept { return sampler != nullptr; }
+
+		constexpr bool is_sampler_current() const noexcept { return current_sampler() != nullptr; }
+
+		inline ref<zone_t<T, Size, BorderSize>> refresh_sampler() noexcept {
+			if (sampler) {
+				sampler->rebuild(cells);
+			}
+
+			return *this;
+		}
+
+		// change tracking stamps written tiles so each subscribed consumer can limit redraws and recomputation to what changed since it last cleared
+		// bulk mutators mark the whole zone and set marks its cell, while mutable subscripts or iterators mark conservatively since the write itself cannot be observed
+		inline ref<zone_t<T, Size, BorderSize>> enable_tracking() noexcept {
+			if (!tracker) {
+				tracker = std::make_unique<dirty_t<Size>>();
+			}
+
+			return *this;
+		}
+
+		inline ref<zone_t<T, Size, BorderSize>> disable_tracking() noexcept {
+			tracker.reset();
+
+			return *this;
+		}
+
+		constexpr bool is_tracking() const noexcept { return tracker != nullptr; }
+
+		constexpr ptr<dirty_t<Size>> tracking() noexcept { return tracker.get(); }
+
+		constexpr cptr<dirty_t<Size>> tracking() const noexcept { return tracker.get(); }
+
+		constexpr ref<zone_t<T, Size, BorderSize>> mark_dirty() noexcept {
+			if (tracker) {
+				tracker->mark();
+			}
+
+			return *this;
+		}
+
+		constexpr ref<zone_t<T, Size, BorderSize>> mark_dirty(offset_t position) noexcept {
+			if (tracker) {
+				tracker->mark(position);
+			}
+
+			return *this;
+		}
+
+		constexpr ref<zone_t<T, Size, BorderSize>> mark_dirty(offset_t origin, offset_t extent) noexcept {
+			if (tracker) {
+				tracker->mark(origin, extent);
+			}
+
+			return *this;
+		}
+
+		constexpr ref<zone_t<T, Size, BorderSize>> set(offset_t position, cref<T> value) noexcept {
+			assign(position, value);
+
+			return *this;
+		}
+
+		template<typename U>
+			requires std::is_assignable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> set(offset_t position, cref<U> value) noexcept {
+			assign(position, value);
+
+			return *this;
+		}
+
+		template<typename U = T>
+			requires is_operable<T, U, operator_e::Addition>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> apply(offset_t position, cref<U> value) noexcept {
+			T result{ cells[position] };
+
+			result += value;
+
+			assign(position, result);
+
+			return *this;
+		}
+
+		template<typename U = T>
+			requires is_operable<T, U, operator_e::Subtraction>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> repeal(offset_t position, cref<U> value) noexcept {
+			T result{ cells[position] };
+
+			result -= value;
+
+			assign(position, result);
+
+			return *this;
+		}
+
 		template<zone_region_e Region> constexpr ref<zone_t<T, Size, BorderSize>> set(cref<T> value) noexcept {
 			if constexpr (Region == zone_region_e::All) {
 				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
@@ -251,6 +649,8 @@ namespace bleak {
 				}
 			}
 
+			touch();
+
 			return *this;
 		}
 
@@ -282,6 +682,8 @@ namespace bleak {
 				}
 			}
 
+			touch();
+
 			return *this;
 		}
 
@@ -319,6 +721,8 @@ namespace bleak {
 				}
 			}
 
+			touch();
+
 			return *this;
 		}
 
@@ -351,6 +755,8 @@ namespace bleak {
 				}
 			}
 
+			touch();
+
 			return *this;
 		}
 
@@ -390,6 +796,8 @@ namespace bleak {
 				}
 			}
 
+			touch();
+
 			return *this;
 		}
 
@@ -421,6 +829,8 @@ namespace bleak {
 				}
 			}
 
+			touch();
+
 			return *this;
 		}
 
@@ -452,6 +862,8 @@ namespace bleak {
 				}
 			}
 
+			touch();
+
 			return *this;
 		}
 
@@ -491,15 +903,23 @@ namespace bleak {
 				}
 			}
 
+			touch();
+
 			return *this;
 		}
 
-		constexpr void swap(ref<array_t<T, Size>> buffer) noexcept { std::swap(cells, buffer); }
+		constexpr void swap(ref<array_t<T, Size>> buffer) noexcept {
+			std::swap(cells, buffer);
+
+			touch();
+		}
 
 		constexpr void sync(cref<array_t<T, Size>> buffer) noexcept {
 			for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
 				cells[i] = buffer[i];
 			}
+
+			touch();
 		}
 
 		template<typename U>
@@ -508,6 +928,8 @@ namespace bleak {
 			for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
 				cells[i] = buffer[i];
 			}
+
+			touch();
 		}
 
 		template<zone_region_e Region, typename U, RandomEngine Randomizer>
@@ -542,6 +964,8 @@ namespace bleak {
 				}
 			}
 
+			touch();
+
 			return *this;
 		}
 
@@ -579,6 +1003,8 @@ namespace bleak {
 				}
 			}
 
+			touch();
+
 			return *this;
 		}
 
@@ -616,6 +1042,8 @@ namespace bleak {
 				}
 			}
 
+			touch();
+
 			return *this;
 		}
 
@@ -653,6 +1081,8 @@ namespace bleak {
 				}
 			}
 
+			touch();
+
 			return *this;
 		}
 
@@ -690,6 +1120,8 @@ namespace bleak {
 				}
 			}
 
+			touch();
+
 			return *this;
 		}
 
@@ -729,6 +1161,8 @@ namespace bleak {
 
 			spoke<Region>(applicator.false_value, spokes);
 
+			touch();
+
 			return *this;
 		}
 
@@ -768,6 +1202,8 @@ namespace bleak {
 
 			spoke<Region>(applicator.false_value, spokes);
 
+			touch();
+
 			return *this;
 		}
 
@@ -868,42 +1304,114 @@ namespace bleak {
 		template<solver_e Solver, bool Safe = false> constexpr u8 calculate_index(offset_t position, cref<T> value) const noexcept {
 			u8 index{ 0 };
 
-			if constexpr (Solver == solver_e::Melded) {
+			if constexpr (Solver == solver_e::Moore) {
 				if constexpr (Safe) {
-					const bool nw{ cells[position + offset_t::Northwest] == value };
-					const bool n{ cells[position + offset_t::North] == value };
-					const bool ne{ cells[position + offset_t::Northeast] == value };
-
-					const bool w{ cells[position + offset_t::West] == value };
-					const bool e{ cells[position + offset_t::East] == value };
-
-					const bool sw{ cells[position + offset_t::Southwest] == value };
-					const bool s{ cells[position + offset_t::South] == value };
-					const bool se{ cells[position + offset_t::Southeast] == value };
-
-					if (nw && n && w) {
+					if (cells[position + offset_t::Northwest] == value) {
+						index += 1 << 7;
+					} if (cells[position + offset_t::North] == value) {
+						index += 1 << 6;
+					} if (cells[position + offset_t::Northeast] == value) {
+						index += 1 << 5;
+					} if (cells[position + offset_t::West] == value) {
+						index += 1 << 4;
+					} if (cells[position + offset_t::East] == value) {
 						index += 1 << 3;
-					} if (n && ne && e) {
+					} if (cells[position + offset_t::Southwest] == value) {
 						index += 1 << 2;
-					} if (e && se && s) {
+					} if (cells[position + offset_t::South] == value) {
 						index += 1 << 1;
-					} if (w && sw && s) {
+					} if (cells[position + offset_t::Southeast] == value) {
 						index += 1 << 0;
 					}
 				} else {
 					if (!within<zone_region_e::All>(position)) {
-						return (1 << 4) - 1;
+						return (1 << 8) - 1;
 					}
 
 					cardinal_t edge{ edge_state(position) };
 
-					const bool nw{ edge.north || edge.west || cells[position + offset_t::Northwest] == value };
-					const bool n{ edge.north || cells[position + offset_t::North] == value };
-					const bool ne{ edge.north || edge.east || cells[position + offset_t::Northeast] == value };
-
-					const bool w{ edge.west || cells[position + offset_t::West] == value };
-					const bool e{ edge.east || cells[position + offset_t::East] == value };
-
+					if (edge.north || edge.west || cells[position + offset_t::Northwest] == value) {
+						index += 1 << 7;
+					} if (edge.north || cells[position + offset_t::North] == value) {
+						index += 1 << 6;
+					} if (edge.north || edge.east || cells[position + offset_t::Northeast] == value) {
+						index += 1 << 5;
+					} if (edge.west || cells[position + offset_t::West] == value) {
+						index += 1 << 4;
+					} if (edge.east || cells[position + offset_t::East] == value) {
+						index += 1 << 3;
+					} if (edge.south || edge.west || cells[position + offset_t::Southwest] == value) {
+						index += 1 << 2;
+					} if (edge.south || cells[position + offset_t::South] == value) {
+						index += 1 << 1;
+					} if (edge.south || edge.east || cells[position + offset_t::Southeast] == value) {
+						index += 1 << 0;
+					}
+				}
+			} else if constexpr (Solver == solver_e::VonNeumann) {
+				if constexpr (Safe) {
+					if (cells[position + offset_t::North] == value) {
+						index += 1 << 3;
+					} if (cells[position + offset_t::East] == value) {
+						index += 1 << 2;
+					} if (cells[position + offset_t::South] == value) {
+						index += 1 << 1;
+					} if (cells[position + offset_t::West] == value) {
+						index += 1 << 0;
+					}
+				} else {
+					if (!within<zone_region_e::All>(position)) {
+						return (1 << 4) - 1;
+					}
+
+					cardinal_t edge{ edge_state(position) };
+
+					if (edge.north || cells[position + offset_t::North] == value) {
+						index += 1 << 3;
+					} if (edge.east || cells[position + offset_t::East] == value) {
+						index += 1 << 2;
+					} if (edge.south || cells[position + offset_t::South] == value) {
+						index += 1 << 1;
+					} if (edge.west || cells[position + offset_t::West] == value) {
+						index += 1 << 0;
+					}
+				}
+			} else if constexpr (Solver == solver_e::Melded) {
+				if constexpr (Safe) {
+					const bool nw{ cells[position + offset_t::Northwest] == value };
+					const bool n{ cells[position + offset_t::North] == value };
+					const bool ne{ cells[position + offset_t::Northeast] == value };
+
+					const bool w{ cells[position + offset_t::West] == value };
+					const bool e{ cells[position + offset_t::East] == value };
+
+					const bool sw{ cells[position + offset_t::Southwest] == value };
+					const bool s{ cells[position + offset_t::South] == value };
+					const bool se{ cells[position + offset_t::Southeast] == value };
+
+					if (nw && n && w) {
+						index += 1 << 3;
+					} if (n && ne && e) {
+						index += 1 << 2;
+					} if (e && se && s) {
+						index += 1 << 1;
+					} if (w && sw && s) {
+						index += 1 << 0;
+					}
+				} else {
+					if (!within<zone_region_e::All>(position)) {
+						return (1 << 4) - 1;
+					}
+
+					cardinal_t edge{ edge_state(position) };
+
+					const bool nw{ edge.north || edge.west || cells[position + offset_t::Northwest] == value };
+					const bool n{ edge.north || cells[position + offset_t::North] == value };
+					const bool ne{ edge.north || edge.east || cells[position + offset_t::Northeast] == value };
+
+					const bool w{ edge.west || cells[position + offset_t::West] == value };
+					const bool e{ edge.east || cells[position + offset_t::East] == value };
+
 					const bool sw{ edge.south || edge.west || cells[position + offset_t::Southwest] == value };
 					const bool s{ edge.south || cells[position + offset_t::South] == value };
 					const bool se{ edge.south || edge.east || cells[position + offset_t::Southeast] == value };
@@ -938,11 +1446,11 @@ namespace bleak {
 
 					if (cells[position] == value) {
 						index += 1 << 3;
-					} if (edge == cardinal_e::East || cells[position + offset_t::East] == value) {
+					} if (edge.east || cells[position + offset_t::East] == value) {
 						index += 1 << 2;
-					} if (edge == cardinal_e::Southeast || cells[position + offset_t::Southeast] == value) {
+					} if (edge.south || edge.east || cells[position + offset_t::Southeast] == value) {
 						index += 1 << 1;
-					} if (edge == cardinal_e::South || cells[position + offset_t::South] == value) {
+					} if (edge.south || cells[position + offset_t::South] == value) {
 						index += 1 << 0;
 					}
 				}
@@ -956,7 +1464,79 @@ namespace bleak {
 		constexpr u8 calculate_index(offset_t position, cref<U> value) const noexcept {
 			u8 index{ 0 };
 
-			if constexpr (Solver == solver_e::Melded) {
+			if constexpr (Solver == solver_e::Moore) {
+				if constexpr (Safe) {
+					if (cells[position + offset_t::Northwest] == value) {
+						index += 1 << 7;
+					} if (cells[position + offset_t::North] == value) {
+						index += 1 << 6;
+					} if (cells[position + offset_t::Northeast] == value) {
+						index += 1 << 5;
+					} if (cells[position + offset_t::West] == value) {
+						index += 1 << 4;
+					} if (cells[position + offset_t::East] == value) {
+						index += 1 << 3;
+					} if (cells[position + offset_t::Southwest] == value) {
+						index += 1 << 2;
+					} if (cells[position + offset_t::South] == value) {
+						index += 1 << 1;
+					} if (cells[position + offset_t::Southeast] == value) {
+						index += 1 << 0;
+					}
+				} else {
+					if (!within<zone_region_e::All>(position)) {
+						return (1 << 8) - 1;
+					}
+
+					cardinal_t edge{ edge_state(position) };
+
+					if (edge.north || edge.west || cells[position + offset_t::Northwest] == value) {
+						index += 1 << 7;
+					} if (edge.north || cells[position + offset_t::North] == value) {
+						index += 1 << 6;
+					} if (edge.north || edge.east || cells[position + offset_t::Northeast] == value) {
+						index += 1 << 5;
+					} if (edge.west || cells[position + offset_t::West] == value) {
+						index += 1 << 4;
+					} if (edge.east || cells[position + offset_t::East] == value) {
+						index += 1 << 3;
+					} if (edge.south || edge.west || cells[position + offset_t::Southwest] == value) {
+						index += 1 << 2;
+					} if (edge.south || cells[position + offset_t::South] == value) {
+						index += 1 << 1;
+					} if (edge.south || edge.east || cells[position + offset_t::Southeast] == value) {
+						index += 1 << 0;
+					}
+				}
+			} else if constexpr (Solver == solver_e::VonNeumann) {
+				if constexpr (Safe) {
+					if (cells[position + offset_t::North] == value) {
+						index += 1 << 3;
+					} if (cells[position + offset_t::East] == value) {
+						index += 1 << 2;
+					} if (cells[position + offset_t::South] == value) {
+						index += 1 << 1;
+					} if (cells[position + offset_t::West] == value) {
+						index += 1 << 0;
+					}
+				} else {
+					if (!within<zone_region_e::All>(position)) {
+						return (1 << 4) - 1;
+					}
+
+					cardinal_t edge{ edge_state(position) };
+
+					if (edge.north || cells[position + offset_t::North] == value) {
+						index += 1 << 3;
+					} if (edge.east || cells[position + offset_t::East] == value) {
+						index += 1 << 2;
+					} if (edge.south || cells[position + offset_t::South] == value) {
+						index += 1 << 1;
+					} if (edge.west || cells[position + offset_t::West] == value) {
+						index += 1 << 0;
+					}
+				}
+			} else if constexpr (Solver == solver_e::Melded) {
 				if constexpr (Safe) {
 					const bool nw{ cells[position + offset_t::Northwest] == value };
 					const bool n{ cells[position + offset_t::North] == value };
@@ -1026,11 +1606,11 @@ namespace bleak {
 
 					if (cells[position] == value) {
 						index += 1 << 3;
-					} if (edge == cardinal_e::East || cells[position + offset_t::East] == value) {
+					} if (edge.east || cells[position + offset_t::East] == value) {
 						index += 1 << 2;
-					} if (edge == cardinal_e::Southeast || cells[position + offset_t::Southeast] == value) {
+					} if (edge.south || edge.east || cells[position + offset_t::Southeast] == value) {
 						index += 1 << 1;
-					} if (edge == cardinal_e::South || cells[position + offset_t::South] == value) {
+					} if (edge.south || cells[position + offset_t::South] == value) {
 						index += 1 << 0;
 					}
 				}
@@ -1039,6 +1619,78 @@ namespace bleak {
 			return index;
 		}
 
+		template<solver_e Solver> static constexpr simd::kernel_e solver_kernel() noexcept {
+			static_assert(Solver != solver_e::Extended, "extended solver has no row kernel!");
+
+			if constexpr (Solver == solver_e::Moore) {
+				return simd::kernel_e::Moore;
+			} else if constexpr (Solver == solver_e::VonNeumann) {
+				return simd::kernel_e::VonNeumann;
+			} else if constexpr (Solver == solver_e::MarchingSquares) {
+				return simd::kernel_e::MarchingSquares;
+			} else {
+				return simd::kernel_e::Melded;
+			}
+		}
+
+		// only meaningful for row-major layouts
+		constexpr cptr<T> row_ptr(extent_t::scalar_t y) const noexcept { return y < 0 || y >= zone_size.h ? nullptr : cells.data_ptr() + static_cast<usize>(y) * zone_size.w; }
+
+		// counts of matching neighbours for every cell of row y written to out[0, width); neighbours beyond the zone count as matching
+		template<typename U = T>
+			requires is_equatable<T, U>::value
+		inline void neighbour_count_row(extent_t::scalar_t y, cref<U> value, ptr<u8> out) const noexcept {
+			if constexpr (row_major) {
+				simd::row<simd::kernel_e::NeighbourCount>(row_ptr(y - 1), row_ptr(y), row_ptr(y + 1), zone_size.w, value, out);
+			} else {
+				for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+					out[x] = neighbour_count<false>(offset_t{ x, y }, value);
+				}
+			}
+		}
+
+		// indices of every cell of row y written to out[0, width); equal to the unsafe calculate_index of each cell
+		template<solver_e Solver, typename U = T>
+			requires is_equatable<T, U>::value
+		inline void calculate_index_row(extent_t::scalar_t y, cref<U> value, ptr<u8> out) const noexcept {
+			if constexpr (row_major) {
+				simd::row<solver_kernel<Solver>()>(row_ptr(y - 1), row_ptr(y), row_ptr(y + 1), zone_size.w, value, out);
+			} else {
+				for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+					out[x] = calculate_index<Solver, false>(offset_t{ x, y }, value);
+				}
+			}
+		}
+
+		// fills an index map of the entire zone in a single row-major sweep; each entry equals the unsafe calculate_index of its cell
+		template<solver_e Solver, typename U = T>
+			requires is_equatable<T, U>::value
+		inline cref<zone_t<T, Size, BorderSize>> calculate_indices(ref<array_t<u8, Size>> indices, cref<U> value) const noexcept {
+			if constexpr (array_t<u8, Size>::layout == layout_e::RowMajor) {
+				for (extent_t::scalar_t y{ zone_origin.y }; y <= zone_extent.y; ++y) {
+					calculate_index_row<Solver>(y, value, indices.data_ptr() + static_cast<usize>(y) * zone_size.w);
+				}
+			} else {
+				for (extent_t::scalar_t y{ zone_origin.y }; y <= zone_extent.y; ++y) {
+					for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
+						indices[x, y] = calculate_index<Solver, false>(offset_t{ x, y }, value);
+					}
+				}
+			}
+
+			return *this;
+		}
+
+		template<solver_e Solver, typename U = T>
+			requires is_equatable<T, U>::value
+		inline array_t<u8, Size> calculate_indices(cref<U> value) const noexcept {
+			array_t<u8, Size> indices{};
+
+			calculate_indices<Solver>(indices, value);
+
+			return indices;
+		}
+
 		template<zone_region_e Region> constexpr ref<zone_t<T, Size, BorderSize>> spoke(cref<T> value, cref<std::vector<offset_t>> spokes) noexcept {
 			if constexpr (Region == zone_region_e::None) {
 				return *this;
@@ -1115,13 +1767,16 @@ namespace bleak {
 			}
 
 			array_t<T, Size> buffer{ cells };
+			array_t<u8, Size> indices{};
+
+			calculate_indices<solver_e::Melded>(indices, value);
 
 			if constexpr (Region == zone_region_e::All) {
-				for (extent_t::product_t y{ 0 }; y < zone_area; ++y) {
-					for (extent_t::product_t x{ 0 }; x < zone_area; ++x) {
+				for (extent_t::scalar_t y{ zone_origin.y }; y <= zone_extent.y; ++y) {
+					for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
 						const offset_t position{ x, y };
 
-						if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
+						if (cells[position] != value || indices[position] != index) {
 							continue;
 						}
 
@@ -1133,7 +1788,7 @@ namespace bleak {
 					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
 						const offset_t position{ x, y };
 
-						if (cells[position] != value || calculate_index<solver_e::Melded, interior_safe>(position, value) != index) {
+						if (cells[position] != value || indices[position] != index) {
 							continue;
 						}
 
@@ -1146,7 +1801,7 @@ namespace bleak {
 						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
 							const offset_t position{ x, y };
 
-							if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
+							if (cells[position] != value || indices[position] != index) {
 								continue;
 							}
 
@@ -1156,7 +1811,7 @@ namespace bleak {
 						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
 							const offset_t inner_position{ i, y };
 
-							if (cells[inner_position] != value || calculate_index<solver_e::Melded>(inner_position, value) != index) {
+							if (cells[inner_position] != value || indices[inner_position] != index) {
 								goto outer_pos;
 							}
 
@@ -1165,7 +1820,7 @@ namespace bleak {
 						outer_pos:
 							const offset_t outer_position{ zone_extent.x - i, y };
 
-							if (cells[outer_position] != value || calculate_index<solver_e::Melded>(outer_position, value) != index) {
+							if (cells[outer_position] != value || indices[outer_position] != index) {
 								continue;
 							}
 
@@ -1188,13 +1843,16 @@ namespace bleak {
 			}
 
 			array_t<T, Size> buffer{ cells };
+			array_t<u8, Size> indices{};
+
+			calculate_indices<solver_e::Melded>(indices, value);
 
 			if constexpr (Region == zone_region_e::All) {
-				for (extent_t::product_t y{ 0 }; y < zone_area; ++y) {
-					for (extent_t::product_t x{ 0 }; x < zone_area; ++x) {
+				for (extent_t::scalar_t y{ zone_origin.y }; y <= zone_extent.y; ++y) {
+					for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
 						const offset_t position{ x, y };
 
-						if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
+						if (cells[position] != value || indices[position] != index) {
 							continue;
 						}
 
@@ -1206,7 +1864,7 @@ namespace bleak {
 					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
 						const offset_t position{ x, y };
 
-						if (cells[position] != value || calculate_index<solver_e::Melded, interior_safe>(position, value) != index) {
+						if (cells[position] != value || indices[position] != index) {
 							continue;
 						}
 
@@ -1219,7 +1877,7 @@ namespace bleak {
 						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
 							const offset_t position{ x, y };
 
-							if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
+							if (cells[position] != value || indices[position] != index) {
 								continue;
 							}
 
@@ -1229,7 +1887,7 @@ namespace bleak {
 						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
 							const offset_t inner_position{ i, y };
 
-							if (cells[inner_position] != value || calculate_index<solver_e::Melded>(inner_position, value) != index) {
+							if (cells[inner_position] != value || indices[inner_position] != index) {
 								goto outer_pos;
 							}
 
@@ -1238,7 +1896,7 @@ namespace bleak {
 						outer_pos:
 							const offset_t outer_position{ zone_extent.x - i, y };
 
-							if (cells[outer_position] != value || calculate_index<solver_e::Melded>(outer_position, value) != index) {
+							if (cells[outer_position] != value || indices[outer_position] != index) {
 								continue;
 							}
 
@@ -1260,12 +1918,16 @@ namespace bleak {
 
 			buffer = cells;
 
+			array_t<u8, Size> indices{};
+
+			calculate_indices<solver_e::Melded>(indices, value);
+
 			if constexpr (Region == zone_region_e::All) {
-				for (extent_t::product_t y{ 0 }; y < zone_area; ++y) {
-					for (extent_t::product_t x{ 0 }; x < zone_area; ++x) {
+				for (extent_t::scalar_t y{ zone_origin.y }; y <= zone_extent.y; ++y) {
+					for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
 						const offset_t position{ x, y };
 
-						if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
+						if (cells[position] != value || indices[position] != index) {
 							continue;
 						}
 
@@ -1277,7 +1939,7 @@ namespace bleak {
 					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
 						const offset_t position{ x, y };
 
-						if (cells[position] != value || calculate_index<solver_e::Melded, interior_safe>(position, value) != index) {
+						if (cells[position] != value || indices[position] != index) {
 							continue;
 						}
 
@@ -1290,7 +1952,7 @@ namespace bleak {
 						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
 							const offset_t position{ x, y };
 
-							if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
+							if (cells[position] != value || indices[position] != index) {
 								continue;
 							}
 
@@ -1300,7 +1962,7 @@ namespace bleak {
 						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
 							const offset_t inner_position{ i, y };
 
-							if (cells[inner_position] != value || calculate_index<solver_e::Melded>(inner_position, value) != index) {
+							if (cells[inner_position] != value || indices[inner_position] != index) {
 								goto outer_pos;
 							}
 
@@ -1309,7 +1971,7 @@ namespace bleak {
 						outer_pos:
 							const offset_t outer_position{ zone_extent.x - i, y };
 
-							if (cells[outer_position] != value || calculate_index<solver_e::Melded>(outer_position, value) != index) {
+							if (cells[outer_position] != value || indices[outer_position] != index) {
 								continue;
 							}
 
@@ -1333,12 +1995,16 @@ namespace bleak {
 
 			buffer = cells;
 
+			array_t<u8, Size> indices{};
+
+			calculate_indices<solver_e::Melded>(indices, value);
+
 			if constexpr (Region == zone_region_e::All) {
-				for (extent_t::product_t y{ 0 }; y < zone_area; ++y) {
-					for (extent_t::product_t x{ 0 }; x < zone_area; ++x) {
+				for (extent_t::scalar_t y{ zone_origin.y }; y <= zone_extent.y; ++y) {
+					for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
 						const offset_t position{ x, y };
 
-						if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
+						if (cells[position] != value || indices[position] != index) {
 							continue;
 						}
 
@@ -1350,7 +2016,7 @@ namespace bleak {
 					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
 						const offset_t position{ x, y };
 
-						if (cells[position] != value || calculate_index<solver_e::Melded, U, interior_safe>(position, value) != index) {
+						if (cells[position] != value || indices[position] != index) {
 							continue;
 						}
 
@@ -1363,7 +2029,7 @@ namespace bleak {
 						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
 							const offset_t position{ x, y };
 
-							if (cells[position] != value || calculate_index<solver_e::Melded>(position, value) != index) {
+							if (cells[position] != value || indices[position] != index) {
 								continue;
 							}
 
@@ -1373,7 +2039,7 @@ namespace bleak {
 						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
 							const offset_t inner_position{ i, y };
 
-							if (cells[inner_position] != value || calculate_index<solver_e::Melded>(inner_position, value) != index) {
+							if (cells[inner_position] != value || indices[inner_position] != index) {
 								goto outer_pos;
 							}
 
@@ -1382,7 +2048,7 @@ namespace bleak {
 						outer_pos:
 							const offset_t outer_position{ zone_extent.x - i, y };
 
-							if (cells[outer_position] != value || calculate_index<solver_e::Melded>(outer_position, value) != index) {
+							if (cells[outer_position] != value || indices[outer_position] != index) {
 								continue;
 							}
 
@@ -1671,103 +2337,608 @@ namespace bleak {
 			return *this;
 		}
 
-		template<zone_region_e Region, RandomEngine Randomizer>
-			requires is_random_engine<Randomizer>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
-			if constexpr (Region == zone_region_e::None) {
-				return *this;
+	  private:
+		// applies a single automatize pass to rows [first_row, last_row) of the region; rows only read cells and write their own buffer cells so bands may run concurrently
+		template<zone_region_e Region, typename U> constexpr void automatize_rows(ref<array_t<T, Size>> buffer, u8 threshold, cref<U> true_value, cref<U> false_state, extent_t::scalar_t first_row, extent_t::scalar_t last_row) const noexcept {
+			if constexpr (Region == zone_region_e::All) {
+				for (extent_t::scalar_t y{ first_row }; y < last_row; ++y) {
+					for (extent_t::scalar_t x{ zone_origin.x }; x <= zone_extent.x; ++x) {
+						modulate(buffer, offset_t{ x, y }, threshold, true_value, false_state);
+					}
+				}
+			} else if constexpr (Region == zone_region_e::Interior) {
+				for (extent_t::scalar_t y{ first_row }; y < last_row; ++y) {
+					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
+						modulate<interior_safe>(buffer, offset_t{ x, y }, threshold, true_value, false_state);
+					}
+				}
+			} else if constexpr (Region == zone_region_e::Border) {
+				for (extent_t::scalar_t y{ first_row }; y < last_row; ++y) {
+					if (y < interior_origin.y || y > interior_extent.y) {
+						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+							modulate(buffer, offset_t{ x, y }, threshold, true_value, false_state);
+						}
+					} else {
+						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
+							modulate(buffer, offset_t{ i, y }, threshold, true_value, false_state);
+							modulate(buffer, offset_t{ zone_extent.x - i, y }, threshold, true_value, false_state);
+						}
+					}
+				}
 			}
+		}
 
-			randomize<Region>(generator, fill_percent, true_value, false_state);
-
-			array_t<T, Size> buffer{ cells };
-
-			automatize<Region>(buffer, iterations, threshold, true_value, false_state);
-			swap(buffer);
+		template<zone_region_e Region> static constexpr extent_t::scalar_t region_first_row() noexcept {
+			if constexpr (Region == zone_region_e::Interior) {
+				return interior_origin.y;
+			} else {
+				return zone_origin.y;
+			}
+		}
 
-			return *this;
+		template<zone_region_e Region> static constexpr extent_t::scalar_t region_last_row() noexcept {
+			if constexpr (Region == zone_region_e::Interior) {
+				return interior_extent.y + 1;
+			} else {
+				return zone_extent.y + 1;
+			}
 		}
 
-		template<zone_region_e Region, RandomEngine Randomizer, typename U>
-			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+		template<zone_region_e Region, typename U> inline cref<zone_t<T, Size, BorderSize>> automatize_parallel_impl(ref<thread_pool_t> pool, ref<array_t<T, Size>> buffer, u8 threshold, cref<U> true_value, cref<U> false_state) const noexcept {
 			if constexpr (Region == zone_region_e::None) {
 				return *this;
 			}
 
-			randomize<Region>(generator, fill_percent, true_value, false_state);
-
-			array_t<T, Size> buffer{ cells };
-
-			automatize<Region>(buffer, iterations, threshold, true_value, false_state);
-			swap(buffer);
+			pool.parallel_for(region_first_row<Region>(), region_last_row<Region>(), [&](isize first_row, isize last_row) {
+				automatize_rows<Region>(buffer, threshold, true_value, false_state, static_cast<extent_t::scalar_t>(first_row), static_cast<extent_t::scalar_t>(last_row));
+			});
 
 			return *this;
 		}
 
-		template<zone_region_e Region, RandomEngine Randomizer>
-			requires is_random_engine<Randomizer>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
+		template<zone_region_e Region, typename U> inline ref<zone_t<T, Size, BorderSize>> automatize_parallel_impl(ref<thread_pool_t> pool, ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
 			if constexpr (Region == zone_region_e::None) {
 				return *this;
 			}
 
-			randomize<Region>(generator, fill_percent, applicator);
-
-			array_t<T, Size> buffer{ cells };
-
-			automatize<Region>(buffer, iterations, threshold, applicator);
-			swap(buffer);
+			// parallel_for only returns once every band has finished, serving as the barrier between generations
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				automatize_parallel_impl<Region>(pool, buffer, threshold, true_value, false_state);
+				swap(buffer);
+			}
 
 			return *this;
 		}
 
-		template<zone_region_e Region, RandomEngine Randomizer, typename U>
-			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
-			if constexpr (Region == zone_region_e::None) {
-				return *this;
+		// runs the fused kernels over rows [first_row, last_row) of the region; rows only read cells and write their own buffer cells so bands may run concurrently
+		template<zone_region_e Region, boundary_e Boundary, typename... Kernels> constexpr void stencil_rows(ref<array_t<T, Size>> buffer, extent_t::scalar_t first_row, extent_t::scalar_t last_row, cref<Kernels>... kernels) const noexcept {
+			if (first_row >= last_row) {
+				return;
 			}
 
-			randomize<Region>(generator, fill_percent, applicator);
+			if constexpr (Region == zone_region_e::All) {
+				stencil::apply<Boundary>(cells, buffer, offset_t{ zone_origin.x, first_row }, offset_t{ zone_extent.x, last_row - 1 }, kernels...);
+			} else if constexpr (Region == zone_region_e::Interior) {
+				stencil::apply<Boundary>(cells, buffer, offset_t{ interior_origin.x, first_row }, offset_t{ interior_extent.x, last_row - 1 }, kernels...);
+			} else if constexpr (Region == zone_region_e::Border) {
+				// same cells as the border loops: whole rows above and below the interior and border_size.w columns at either side of the rows between
+				const extent_t::scalar_t top_last{ min<extent_t::scalar_t>(last_row, interior_origin.y) };
+				const extent_t::scalar_t bottom_first{ max<extent_t::scalar_t>(first_row, interior_extent.y + 1) };
 
-			array_t<T, Size> buffer{ cells };
+				const extent_t::scalar_t middle_first{ max<extent_t::scalar_t>(first_row, interior_origin.y) };
+				const extent_t::scalar_t middle_last{ min<extent_t::scalar_t>(last_row, interior_extent.y + 1) };
 
-			automatize<Region>(buffer, iterations, threshold, applicator);
-			swap(buffer);
+				if (first_row < top_last) {
+					stencil::apply<Boundary>(cells, buffer, offset_t{ zone_origin.x, first_row }, offset_t{ zone_extent.x, top_last - 1 }, kernels...);
+				}
+
+				if (middle_first < middle_last && border_size.w > 0) {
+					stencil::apply<Boundary>(cells, buffer, offset_t{ zone_origin.x, middle_first }, offset_t{ border_size.w - 1, middle_last - 1 }, kernels...);
+					stencil::apply<Boundary>(cells, buffer, offset_t{ zone_extent.x - border_size.w + 1, middle_first }, offset_t{ zone_extent.x, middle_last - 1 }, kernels...);
+				}
+
+				if (bottom_first < last_row) {
+					stencil::apply<Boundary>(cells, buffer, offset_t{ zone_origin.x, bottom_first }, offset_t{ zone_extent.x, last_row - 1 }, kernels...);
+				}
+			}
+		}
+
+	  public:
+		// applies every kernel to each cell of the region in one pass over the zone, writing into buffer; cells outside the region are left as they are in buffer
+		// see stencil::apply for how kernels are fused and how cells beyond the zone are resolved
+		template<zone_region_e Region, boundary_e Boundary = boundary_e::Match, StencilKernel... Kernels> constexpr cref<zone_t<T, Size, BorderSize>> stencil(ref<array_t<T, Size>> buffer, cref<Kernels>... kernels) const noexcept {
+			if constexpr (Region != zone_region_e::None) {
+				stencil_rows<Region, Boundary>(buffer, region_first_row<Region>(), region_last_row<Region>(), kernels...);
+			}
 
 			return *this;
 		}
 
-		template<zone_region_e Region, RandomEngine Randomizer>
-			requires is_random_engine<Randomizer>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator, cref<std::vector<offset_t>> spokes) noexcept {
-			if constexpr (Region == zone_region_e::None) {
-				return *this;
+		template<zone_region_e Region, boundary_e Boundary = boundary_e::Match, StencilKernel... Kernels> inline cref<zone_t<T, Size, BorderSize>> stencil(ref<thread_pool_t> pool, ref<array_t<T, Size>> buffer, cref<Kernels>... kernels) const noexcept {
+			if constexpr (Region != zone_region_e::None) {
+				pool.parallel_for(region_first_row<Region>(), region_last_row<Region>(), [&](isize first_row, isize last_row) {
+					stencil_rows<Region, Boundary>(buffer, static_cast<extent_t::scalar_t>(first_row), static_cast<extent_t::scalar_t>(last_row), kernels...);
+				});
 			}
 
-			randomize<Region>(generator, fill_percent, applicator, spokes);
+			return *this;
+		}
 
-			array_t<T, Size> buffer{ cells };
+		// runs the fused pass for a number of generations, swapping the buffer in after each
+		template<zone_region_e Region, boundary_e Boundary = boundary_e::Match, StencilKernel... Kernels> constexpr ref<zone_t<T, Size, BorderSize>> stencil(ref<array_t<T, Size>> buffer, u32 iterations, cref<Kernels>... kernels) noexcept {
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				buffer = cells;
 
-			automatize<Region>(buffer, iterations, threshold, applicator, spokes);
-			swap(buffer);
+				stencil<Region, Boundary>(buffer, kernels...);
+				swap(buffer);
+			}
 
 			return *this;
 		}
 
-		template<zone_region_e Region, RandomEngine Randomizer, typename U>
-			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
+		template<zone_region_e Region, boundary_e Boundary = boundary_e::Match, StencilKernel... Kernels> inline ref<zone_t<T, Size, BorderSize>> stencil(ref<thread_pool_t> pool, ref<array_t<T, Size>> buffer, u32 iterations, cref<Kernels>... kernels) noexcept {
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				buffer = cells;
+
+				stencil<Region, Boundary>(pool, buffer, kernels...);
+				swap(buffer);
+			}
+
+			return *this;
+		}
+
+	  private:
+		// samples rows [first_row, last_row) of the region at their cell positions offset by origin, handing each cell and its sample to writer
+		template<zone_region_e Region, noise_e Noise, typename Writer> inline void noise_rows(cref<noise_t<Noise>> generator, offset_t origin, extent_t::scalar_t first_row, extent_t::scalar_t last_row, cref<Writer> writer) noexcept {
+			std::array<f32, zone_size.w> samples;
+
+			for (extent_t::scalar_t y{ first_row }; y < last_row; ++y) {
+				const auto fill{ [&](extent_t::scalar_t left, extent_t::scalar_t right) {
+					generator.row(samples.data() + left, static_cast<usize>(right - left + 1), static_cast<f32>(origin.x + left), static_cast<f32>(origin.y + y));
+
+					for (extent_t::scalar_t x{ left }; x <= right; ++x) {
+						writer(cells[x, y], samples[x]);
+					}
+				} };
+
+				if constexpr (Region == zone_region_e::All) {
+					fill(zone_origin.x, zone_extent.x);
+				} else if constexpr (Region == zone_region_e::Interior) {
+					fill(interior_origin.x, interior_extent.x);
+				} else if constexpr (Region == zone_region_e::Border) {
+					if (y < interior_origin.y || y > interior_extent.y) {
+						fill(zone_origin.x, zone_extent.x);
+					} else if (border_size.w > 0) {
+						fill(zone_origin.x, border_size.w - 1);
+						fill(zone_extent.x - border_size.w + 1, zone_extent.x);
+					}
+				}
+			}
+		}
+
+		template<zone_region_e Region, noise_e Noise, typename Writer> inline ref<zone_t<T, Size, BorderSize>> noise_impl(cref<noise_t<Noise>> generator, offset_t origin, cref<Writer> writer) noexcept {
+			if constexpr (Region != zone_region_e::None) {
+				noise_rows<Region>(generator, origin, region_first_row<Region>(), region_last_row<Region>(), writer);
+
+				touch();
+			}
+
+			return *this;
+		}
+
+		template<zone_region_e Region, noise_e Noise, typename Writer> inline ref<zone_t<T, Size, BorderSize>> noise_impl(ref<thread_pool_t> pool, cref<noise_t<Noise>> generator, offset_t origin, cref<Writer> writer) noexcept {
+			if constexpr (Region != zone_region_e::None) {
+				// every band writes only its own rows
+				pool.parallel_for(region_first_row<Region>(), region_last_row<Region>(), [&](isize first_row, isize last_row) {
+					noise_rows<Region>(generator, origin, static_cast<extent_t::scalar_t>(first_row), static_cast<extent_t::scalar_t>(last_row), writer);
+				});
+
+				touch();
+			}
+
+			return *this;
+		}
+
+	  public:
+		// fills the region with fractal noise sampled at each cell position plus origin; zones sampled at their placement within a larger map tile seamlessly
+		template<zone_region_e Region, noise_e Noise>
+			requires std::is_floating_point<T>::value
+		inline ref<zone_t<T, Size, BorderSize>> noise(cref<noise_t<Noise>> generator, offset_t origin = offset_t::Zero) noexcept {
+			return noise_impl<Region>(generator, origin, [](ref<T> cell, f32 sample) { cell = static_cast<T>(sample); });
+		}
+
+		template<zone_region_e Region, noise_e Noise>
+			requires std::is_floating_point<T>::value
+		inline ref<zone_t<T, Size, BorderSize>> noise(ref<thread_pool_t> pool, cref<noise_t<Noise>> generator, offset_t origin = offset_t::Zero) noexcept {
+			return noise_impl<Region>(pool, generator, origin, [](ref<T> cell, f32 sample) { cell = static_cast<T>(sample); });
+		}
+
+		// sets cells whose sample exceeds threshold to true_value and the rest to false_value
+		template<zone_region_e Region, noise_e Noise, typename U = T>
+			requires std::is_assignable<ref<T>, cref<U>>::value
+		inline ref<zone_t<T, Size, BorderSize>> noise(cref<noise_t<Noise>> generator, f32 threshold, cref<U> true_value, cref<U> false_value, offset_t origin = offset_t::Zero) noexcept {
+			return noise_impl<Region>(generator, origin, [&](ref<T> cell, f32 sample) { cell = sample > threshold ? true_value : false_value; });
+		}
+
+		template<zone_region_e Region, noise_e Noise, typename U = T>
+			requires std::is_assignable<ref<T>, cref<U>>::value
+		inline ref<zone_t<T, Size, BorderSize>> noise(ref<thread_pool_t> pool, cref<noise_t<Noise>> generator, f32 threshold, cref<U> true_value, cref<U> false_value, offset_t origin = offset_t::Zero) noexcept {
+			return noise_impl<Region>(pool, generator, origin, [&](ref<T> cell, f32 sample) { cell = sample > threshold ? true_value : false_value; });
+		}
+
+	  public:
+		template<zone_region_e Region> inline cref<zone_t<T, Size, BorderSize>> automatize(ref<thread_pool_t> pool, ref<array_t<T, Size>> buffer, u8 threshold, cref<T> true_value, cref<T> false_state) const noexcept {
+			return automatize_parallel_impl<Region>(pool, buffer, threshold, true_value, false_state);
+		}
+
+		template<zone_region_e Region, typename U>
+			requires std::is_assignable<T, U>::value
+		inline cref<zone_t<T, Size, BorderSize>> automatize(ref<thread_pool_t> pool, ref<array_t<T, Size>> buffer, u8 threshold, cref<U> true_value, cref<U> false_state) const noexcept {
+			return automatize_parallel_impl<Region>(pool, buffer, threshold, true_value, false_state);
+		}
+
+		template<zone_region_e Region> inline cref<zone_t<T, Size, BorderSize>> automatize(ref<thread_pool_t> pool, ref<array_t<T, Size>> buffer, u8 threshold, cref<binary_applicator_t<T>> applicator) const noexcept {
+			return automatize_parallel_impl<Region>(pool, buffer, threshold, applicator.true_value, applicator.false_value);
+		}
+
+		template<zone_region_e Region, typename U>
+			requires std::is_assignable<T, U>::value
+		inline cref<zone_t<T, Size, BorderSize>> automatize(ref<thread_pool_t> pool, ref<array_t<T, Size>> buffer, u8 threshold, cref<binary_applicator_t<U>> applicator) const noexcept {
+			return automatize_parallel_impl<Region>(pool, buffer, threshold, applicator.true_value, applicator.false_value);
+		}
+
+		template<zone_region_e Region> inline ref<zone_t<T, Size, BorderSize>> automatize(ref<thread_pool_t> pool, ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
+			return automatize_parallel_impl<Region>(pool, buffer, iterations, threshold, true_value, false_state);
+		}
+
+		template<zone_region_e Region, typename U>
+			requires std::is_assignable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize>> automatize(ref<thread_pool_t> pool, ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+			return automatize_parallel_impl<Region>(pool, buffer, iterations, threshold, true_value, false_state);
+		}
+
+		template<zone_region_e Region> inline ref<zone_t<T, Size, BorderSize>> automatize(ref<thread_pool_t> pool, ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
+			return automatize_parallel_impl<Region>(pool, buffer, iterations, threshold, applicator.true_value, applicator.false_value);
+		}
+
+		template<zone_region_e Region, typename U>
+			requires std::is_assignable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize>> automatize(ref<thread_pool_t> pool, ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+			return automatize_parallel_impl<Region>(pool, buffer, iterations, threshold, applicator.true_value, applicator.false_value);
+		}
+
+	  private:
+		template<zone_region_e Region> static constexpr bitboard_t<Size> region_mask() noexcept {
+			bitboard_t<Size> mask{};
+
+			if constexpr (Region == zone_region_e::All) {
+				mask.fill(true);
+			} else if constexpr (Region == zone_region_e::Interior) {
+				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
+					mask.fill(y, interior_origin.x, interior_extent.x, true);
+				}
+			} else if constexpr (Region == zone_region_e::Border) {
+				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+					if (y < interior_origin.y || y > interior_extent.y) {
+						mask.fill(y, 0, zone_extent.x, true);
+					} else if (border_size.w > 0) {
+						mask.fill(y, 0, border_size.w - 1, true);
+						mask.fill(y, zone_extent.x - border_size.w + 1, zone_extent.x, true);
+					}
+				}
+			}
+
+			return mask;
+		}
+
+		template<typename U = T>
+			requires is_equatable<T, U>::value
+		static constexpr void pack(ref<bitboard_t<Size>> board, cref<array_t<T, Size>> source, cref<U> value) noexcept {
+			for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+					board.set(x, y, source[x, y] == value);
+				}
+			}
+		}
+
+		template<zone_region_e Region, typename U = T>
+			requires std::is_assignable<T, U>::value
+		static constexpr void unpack(ref<array_t<T, Size>> destination, cref<bitboard_t<Size>> board, cref<bitboard_t<Size>> mask, cref<U> true_value, cref<U> false_value) noexcept {
+			for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+				for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+					if (mask[x, y]) {
+						destination[x, y] = board[x, y] ? true_value : false_value;
+					}
+				}
+			}
+		}
+
+		// bit-packed counterpart of the iterative automatize; both cells and buffer must hold only the true or false value within the region
+		template<zone_region_e Region, typename U> constexpr ref<zone_t<T, Size, BorderSize>> automatize_packed_impl(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_value, ptr<thread_pool_t> pool = nullptr) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			if (iterations == 0) {
+				return *this;
+			}
+
+			const bitboard_t<Size> mask{ region_mask<Region>() };
+
+			// the generations ping-pong between a pair of boards by pointer, so an iteration never copies a board
+			bitboard_t<Size> boards[2]{};
+
+			ptr<bitboard_t<Size>> current{ &boards[0] };
+			ptr<bitboard_t<Size>> previous{ &boards[1] };
+
+			pack(*current, cells, true_value);
+			pack(*previous, buffer, true_value);
+
+			for (u32 i{ 0 }; i < iterations; ++i) {
+				if (pool != nullptr) {
+					pool->parallel_for(0, zone_size.h, [&](isize first_row, isize last_row) {
+						bitboard_t<Size>::automatize(*previous, *current, *previous, mask, threshold, static_cast<extent_t::scalar_t>(first_row), static_cast<extent_t::scalar_t>(last_row - 1));
+					});
+				} else {
+					bitboard_t<Size>::automatize(*previous, *current, *previous, mask, threshold);
+				}
+
+				std::swap(current, previous);
+			}
+
+			// cells outside of the region ping-pong along with the buffer in the unpacked path
+			if (iterations % 2 == 1) {
+				swap(buffer);
+			}
+
+			unpack<Region>(cells, *current, mask, true_value, false_value);
+			unpack<Region>(buffer, *previous, mask, true_value, false_value);
+
+			touch();
+
+			return *this;
+		}
+
+	  public:
+		template<zone_region_e Region> constexpr ref<zone_t<T, Size, BorderSize>> automatize_packed(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
+			return automatize_packed_impl<Region>(buffer, iterations, threshold, true_value, false_state);
+		}
+
+		template<zone_region_e Region, typename U>
+			requires std::is_assignable<T, U>::value && is_equatable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> automatize_packed(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+			return automatize_packed_impl<Region>(buffer, iterations, threshold, true_value, false_state);
+		}
+
+		template<zone_region_e Region> constexpr ref<zone_t<T, Size, BorderSize>> automatize_packed(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
+			return automatize_packed_impl<Region>(buffer, iterations, threshold, applicator.true_value, applicator.false_value);
+		}
+
+		template<zone_region_e Region, typename U>
+			requires std::is_assignable<T, U>::value && is_equatable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> automatize_packed(ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+			return automatize_packed_impl<Region>(buffer, iterations, threshold, applicator.true_value, applicator.false_value);
+		}
+
+		template<zone_region_e Region> inline ref<zone_t<T, Size, BorderSize>> automatize_packed(ref<thread_pool_t> pool, ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
+			return automatize_packed_impl<Region>(buffer, iterations, threshold, true_value, false_state, &pool);
+		}
+
+		template<zone_region_e Region, typename U>
+			requires std::is_assignable<T, U>::value && is_equatable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize>> automatize_packed(ref<thread_pool_t> pool, ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+			return automatize_packed_impl<Region>(buffer, iterations, threshold, true_value, false_state, &pool);
+		}
+
+		template<zone_region_e Region> inline ref<zone_t<T, Size, BorderSize>> automatize_packed(ref<thread_pool_t> pool, ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
+			return automatize_packed_impl<Region>(buffer, iterations, threshold, applicator.true_value, applicator.false_value, &pool);
+		}
+
+		template<zone_region_e Region, typename U>
+			requires std::is_assignable<T, U>::value && is_equatable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize>> automatize_packed(ref<thread_pool_t> pool, ref<array_t<T, Size>> buffer, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+			return automatize_packed_impl<Region>(buffer, iterations, threshold, applicator.true_value, applicator.false_value, &pool);
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer>
+			requires is_random_engine<Randomizer>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, true_value, false_state);
+
+			array_t<T, Size> buffer{ cells };
+
+			automatize<Region>(buffer, iterations, threshold, true_value, false_state);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer, typename U>
+			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, true_value, false_state);
+
+			array_t<T, Size> buffer{ cells };
+
+			automatize<Region>(buffer, iterations, threshold, true_value, false_state);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer>
+			requires is_random_engine<Randomizer>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, applicator);
+
+			array_t<T, Size> buffer{ cells };
+
+			automatize<Region>(buffer, iterations, threshold, applicator);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer, typename U>
+			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, applicator);
+
+			array_t<T, Size> buffer{ cells };
+
+			automatize<Region>(buffer, iterations, threshold, applicator);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer>
+			requires is_random_engine<Randomizer>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator, cref<std::vector<offset_t>> spokes) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, applicator, spokes);
+
+			array_t<T, Size> buffer{ cells };
+
+			automatize<Region>(buffer, iterations, threshold, applicator, spokes);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer, typename U>
+			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
 		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator, cref<std::vector<offset_t>> spokes) noexcept {
 			if constexpr (Region == zone_region_e::None) {
 				return *this;
 			}
 
-			randomize<Region>(generator, fill_percent, applicator, spokes);
+			randomize<Region>(generator, fill_percent, applicator, spokes);
+
+			array_t<T, Size> buffer{ cells };
+
+			automatize<Region>(buffer, iterations, threshold, applicator, spokes);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer>
+			requires is_random_engine<Randomizer>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, true_value, false_state);
+
+			buffer = cells;
+
+			automatize<Region>(buffer, iterations, threshold, true_value, false_state);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer, typename U>
+			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, true_value, false_state);
+
+			buffer = cells;
+
+			automatize<Region>(buffer, iterations, threshold, true_value, false_state);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer>
+			requires is_random_engine<Randomizer>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, applicator);
+
+			buffer = cells;
+
+			automatize<Region>(buffer, iterations, threshold, applicator);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer, typename U>
+			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, applicator);
+
+			buffer = cells;
+
+			automatize<Region>(buffer, iterations, threshold, applicator);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer>
+			requires is_random_engine<Randomizer>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> generate_packed(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, true_value, false_state);
+
+			array_t<T, Size> buffer{ cells };
+
+			automatize_packed<Region>(buffer, iterations, threshold, true_value, false_state);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer, typename U>
+			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value && is_equatable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> generate_packed(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, true_value, false_state);
 
 			array_t<T, Size> buffer{ cells };
 
-			automatize<Region>(buffer, iterations, threshold, applicator, spokes);
+			automatize_packed<Region>(buffer, iterations, threshold, true_value, false_state);
 			swap(buffer);
 
 			return *this;
@@ -1775,7 +2946,41 @@ namespace bleak {
 
 		template<zone_region_e Region, RandomEngine Randomizer>
 			requires is_random_engine<Randomizer>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
+		constexpr ref<zone_t<T, Size, BorderSize>> generate_packed(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, applicator);
+
+			array_t<T, Size> buffer{ cells };
+
+			automatize_packed<Region>(buffer, iterations, threshold, applicator);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer, typename U>
+			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value && is_equatable<T, U>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> generate_packed(ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, applicator);
+
+			array_t<T, Size> buffer{ cells };
+
+			automatize_packed<Region>(buffer, iterations, threshold, applicator);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer>
+			requires is_random_engine<Randomizer>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> generate_packed(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
 			if constexpr (Region == zone_region_e::None) {
 				return *this;
 			}
@@ -1784,7 +2989,41 @@ namespace bleak {
 
 			buffer = cells;
 
-			automatize<Region>(buffer, iterations, threshold, true_value, false_state);
+			automatize_packed<Region>(buffer, iterations, threshold, true_value, false_state);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer>
+			requires is_random_engine<Randomizer>::value
+		constexpr ref<zone_t<T, Size, BorderSize>> generate_packed(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, applicator);
+
+			buffer = cells;
+
+			automatize_packed<Region>(buffer, iterations, threshold, applicator);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer>
+			requires is_random_engine<Randomizer>::value
+		inline ref<zone_t<T, Size, BorderSize>> generate(ref<thread_pool_t> pool, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, true_value, false_state);
+
+			array_t<T, Size> buffer{ cells };
+
+			automatize<Region>(pool, buffer, iterations, threshold, true_value, false_state);
 			swap(buffer);
 
 			return *this;
@@ -1792,16 +3031,16 @@ namespace bleak {
 
 		template<zone_region_e Region, RandomEngine Randomizer, typename U>
 			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+		inline ref<zone_t<T, Size, BorderSize>> generate(ref<thread_pool_t> pool, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
 			if constexpr (Region == zone_region_e::None) {
 				return *this;
 			}
 
 			randomize<Region>(generator, fill_percent, true_value, false_state);
 
-			buffer = cells;
+			array_t<T, Size> buffer{ cells };
 
-			automatize<Region>(buffer, iterations, threshold, true_value, false_state);
+			automatize<Region>(pool, buffer, iterations, threshold, true_value, false_state);
 			swap(buffer);
 
 			return *this;
@@ -1809,16 +3048,16 @@ namespace bleak {
 
 		template<zone_region_e Region, RandomEngine Randomizer>
 			requires is_random_engine<Randomizer>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
+		inline ref<zone_t<T, Size, BorderSize>> generate(ref<thread_pool_t> pool, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
 			if constexpr (Region == zone_region_e::None) {
 				return *this;
 			}
 
 			randomize<Region>(generator, fill_percent, applicator);
 
-			buffer = cells;
+			array_t<T, Size> buffer{ cells };
 
-			automatize<Region>(buffer, iterations, threshold, applicator);
+			automatize<Region>(pool, buffer, iterations, threshold, applicator);
 			swap(buffer);
 
 			return *this;
@@ -1826,21 +3065,98 @@ namespace bleak {
 
 		template<zone_region_e Region, RandomEngine Randomizer, typename U>
 			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value
-		constexpr ref<zone_t<T, Size, BorderSize>> generate(ref<array_t<T, Size>> buffer, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+		inline ref<zone_t<T, Size, BorderSize>> generate(ref<thread_pool_t> pool, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
 			if constexpr (Region == zone_region_e::None) {
 				return *this;
 			}
 
 			randomize<Region>(generator, fill_percent, applicator);
 
-			buffer = cells;
+			array_t<T, Size> buffer{ cells };
 
-			automatize<Region>(buffer, iterations, threshold, applicator);
+			automatize<Region>(pool, buffer, iterations, threshold, applicator);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer>
+			requires is_random_engine<Randomizer>::value
+		inline ref<zone_t<T, Size, BorderSize>> generate_packed(ref<thread_pool_t> pool, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<T> true_value, cref<T> false_state) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, true_value, false_state);
+
+			array_t<T, Size> buffer{ cells };
+
+			automatize_packed<Region>(pool, buffer, iterations, threshold, true_value, false_state);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer, typename U>
+			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value && is_equatable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize>> generate_packed(ref<thread_pool_t> pool, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<U> true_value, cref<U> false_state) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, true_value, false_state);
+
+			array_t<T, Size> buffer{ cells };
+
+			automatize_packed<Region>(pool, buffer, iterations, threshold, true_value, false_state);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer>
+			requires is_random_engine<Randomizer>::value
+		inline ref<zone_t<T, Size, BorderSize>> generate_packed(ref<thread_pool_t> pool, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<T>> applicator) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, applicator);
+
+			array_t<T, Size> buffer{ cells };
+
+			automatize_packed<Region>(pool, buffer, iterations, threshold, applicator);
+			swap(buffer);
+
+			return *this;
+		}
+
+		template<zone_region_e Region, RandomEngine Randomizer, typename U>
+			requires is_random_engine<Randomizer>::value && std::is_assignable<T, U>::value && is_equatable<T, U>::value
+		inline ref<zone_t<T, Size, BorderSize>> generate_packed(ref<thread_pool_t> pool, ref<Randomizer> generator, f64 fill_percent, u32 iterations, u8 threshold, cref<binary_applicator_t<U>> applicator) noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return *this;
+			}
+
+			randomize<Region>(generator, fill_percent, applicator);
+
+			array_t<T, Size> buffer{ cells };
+
+			automatize_packed<Region>(pool, buffer, iterations, threshold, applicator);
 			swap(buffer);
 
 			return *this;
 		}
 
+		// sampling through a mutable zone first rebuilds a stale sampler, so any number of writes since the last query cost a single rebuild
+		template<zone_region_e Region, RandomEngine Randomizer, typename... Params>
+			requires is_random_engine<Randomizer>::value
+		inline std::optional<offset_t> find_random(ref<Randomizer> generator, cref<Params>... params) noexcept {
+			prepare_sampler();
+
+			return std::as_const(*this).template find_random<Region>(generator, params...);
+		}
+
 		template<zone_region_e Region, RandomEngine Randomizer>
 			requires is_random_engine<Randomizer>::value
 		constexpr std::optional<offset_t> find_random(ref<Randomizer> generator, cref<T> value) const noexcept {
@@ -1848,6 +3164,10 @@ namespace bleak {
 				return *this;
 			}
 
+			if (cptr<sampler_t<T, Size, BorderSize>> index{ current_sampler() }; index != nullptr) {
+				return index->sample(generator, value, samples_interior<Region>(), samples_border<Region>());
+			}
+
 			if constexpr (Region == zone_region_e::All) {
 				std::uniform_int_distribution<offset_t::scalar_t> x_dis{ 0, zone_extent.x };
 				std::uniform_int_distribution<offset_t::scalar_t> y_dis{ 0, zone_extent.y };
@@ -1895,6 +3215,10 @@ namespace bleak {
 		template<zone_region_e Region, RandomEngine Randomizer, typename U>
 			requires is_random_engine<Randomizer>::value && is_equatable<T, U>::value
 		constexpr std::optional<offset_t> find_random(ref<Randomizer> generator, cref<U> value) const noexcept {
+			if (cptr<sampler_t<T, Size, BorderSize>> index{ current_sampler() }; index != nullptr) {
+				return index->sample(generator, value, samples_interior<Region>(), samples_border<Region>());
+			}
+
 			if constexpr (Region == zone_region_e::All) {
 				std::uniform_int_distribution<offset_t::scalar_t> x_dis{ 0, zone_extent.x };
 				std::uniform_int_distribution<offset_t::scalar_t> y_dis{ 0, zone_extent.y };
@@ -1948,6 +3272,10 @@ namespace bleak {
 				return *this;
 			}
 
+			if (cptr<sampler_t<T, Size, BorderSize>> index{ current_sampler() }; index != nullptr) {
+				return index->sample(generator, value, samples_interior<Region>(), samples_border<Region>(), [&](offset_t position) -> bool { return sparse_blockage.contains(position); });
+			}
+
 			if constexpr (Region == zone_region_e::All) {
 				std::uniform_int_distribution<offset_t::scalar_t> x_dis{ 0, zone_extent.x };
 				std::uniform_int_distribution<offset_t::scalar_t> y_dis{ 0, zone_extent.y };
@@ -2005,6 +3333,10 @@ namespace bleak {
 				return *this;
 			}
 
+			if (cptr<sampler_t<T, Size, BorderSize>> index{ current_sampler() }; index != nullptr) {
+				return index->sample(generator, value, samples_interior<Region>(), samples_border<Region>(), [&](offset_t position) -> bool { return sparse_blockage.contains(position); });
+			}
+
 			if constexpr (Region == zone_region_e::All) {
 				std::uniform_int_distribution<offset_t::scalar_t> x_dis{ 0, zone_extent.x };
 				std::uniform_int_distribution<offset_t::scalar_t> y_dis{ 0, zone_extent.y };
@@ -2061,6 +3393,10 @@ namespace bleak {
 				return *this;
 			}
 
+			if (cptr<sampler_t<T, Size, BorderSize>> index{ current_sampler() }; index != nullptr) {
+				return index->sample(generator, value, samples_interior<Region>(), samples_border<Region>(), [&](offset_t position) -> bool { return entity_blockage.contains(position) || object_blockage.contains(position); });
+			}
+
 			if constexpr (Region == zone_region_e::All) {
 				std::uniform_int_distribution<offset_t::scalar_t> x_dis{ 0, zone_extent.x };
 				std::uniform_int_distribution<offset_t::scalar_t> y_dis{ 0, zone_extent.y };
@@ -2118,6 +3454,10 @@ namespace bleak {
 				return *this;
 			}
 
+			if (cptr<sampler_t<T, Size, BorderSize>> index{ current_sampler() }; index != nullptr) {
+				return index->sample(generator, value, samples_interior<Region>(), samples_border<Region>());
+			}
+
 			if constexpr (Region == zone_region_e::All) {
 				std::uniform_int_distribution<offset_t::scalar_t> x_dis{ 0, zone_extent.x };
 				std::uniform_int_distribution<offset_t::scalar_t> y_dis{ 0, zone_extent.y };
@@ -2174,7 +3514,7 @@ namespace bleak {
 			}
 
 			if (origin == target) {
-				cells[origin] = value;
+				assign(origin, value);
 
 				return;
 			}
@@ -2204,7 +3544,7 @@ namespace bleak {
 					return;
 				}
 
-				cells[current_position] = value;
+				assign(current_position, value);
 
 				if (current_position == target) {
 					return;
@@ -2220,7 +3560,7 @@ namespace bleak {
 			}
 
 			if (origin == target) {
-				cells[origin] = value;
+				assign(origin, value);
 
 				return;
 			}
@@ -2250,7 +3590,7 @@ namespace bleak {
 					return;
 				}
 
-				cells[current_position] = value;
+				assign(current_position, value);
 
 				if (current_position == target) {
 					return;
@@ -2425,193 +3765,96 @@ namespace bleak {
 
 				if (e2 < delta.x) {
 					err += delta.x;
-					current_position.y += step.y;
-				}
-			}
-		}
-
-		template<zone_region_e Region> constexpr u32 count(cref<T> value) const noexcept {
-			u32 total{ 0 };
-
-			if constexpr (Region == zone_region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					if (cells[i] == value) {
-						++total;
-					}
-				}
-			} else if constexpr (Region == zone_region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						if (cells[x, y] == value) {
-							++total;
-						}
-					}
-				}
-			} else if constexpr (Region == zone_region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							if (cells[x, y] == value) {
-								++total;
-							}
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							if (cells[i, y] == value) {
-								++total;
-							}
-							if (cells[zone_extent.x - i, y] == value) {
-								++total;
-							}
-						}
-					}
-				}
-			} else if constexpr (Region == zone_region_e::None) {
-				return 0;
-			}
-
-			return total;
-		}
-
-		template<zone_region_e Region, typename U>
-			requires is_equatable<T, U>::value
-		constexpr u32 count(cref<U> value) const noexcept {
-			u32 total{ 0 };
-
-			if constexpr (Region == zone_region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					if (cells[i] == value) {
-						++total;
-					}
-				}
-			} else if constexpr (Region == zone_region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						if (cells[x, y] == value) {
-							++total;
-						}
-					}
-				}
-			} else if constexpr (Region == zone_region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							if (cells[x, y] == value) {
-								++total;
-							}
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							if (cells[i, y] == value) {
-								++total;
-							}
-							if (cells[zone_extent.x - i, y] == value) {
-								++total;
-							}
-						}
-					}
-				}
-			} else if constexpr (Region == zone_region_e::None) {
-				return 0;
-			}
-
-			return total;
-		}
-
-		template<zone_region_e Region> constexpr u32 contains(cref<T> value) const noexcept {
-			if constexpr (Region == zone_region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					if (cells[i] == value) {
-						return true;
-					}
-				}
-
-				return false;
-			} else if constexpr (Region == zone_region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						if (cells[x, y] == value) {
-							return true;
-						}
-					}
-				}
-
-				return false;
-			} else if constexpr (Region == zone_region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							if (cells[x, y] == value) {
-								return true;
-							}
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							if (cells[i, y] == value) {
-								return true;
-							}
-							if (cells[zone_extent.x - i, y] == value) {
-								return true;
-							}
-						}
-					}
-				}
-
-				return false;
-			} else if constexpr (Region == zone_region_e::None) {
-				return false;
+					current_position.y += step.y;
+				}
 			}
+		}
 
-			return false;
+		template<zone_region_e Region> inline u32 count(cref<T> value) const noexcept { return count_spans<Region>(value); }
+
+		template<zone_region_e Region, typename U>
+			requires is_equatable<T, U>::value
+		inline u32 count(cref<U> value) const noexcept {
+			return count_spans<Region>(value);
 		}
 
+		template<zone_region_e Region> inline u32 contains(cref<T> value) const noexcept { return contains_spans<Region>(value); }
+
 		template<zone_region_e Region, typename U>
 			requires is_equatable<T, U>::value
-		constexpr u32 contains(cref<U> value) const noexcept {
-			if constexpr (Region == zone_region_e::All) {
-				for (extent_t::product_t i{ 0 }; i < zone_area; ++i) {
-					if (cells[i] == value) {
-						return true;
+		inline u32 contains(cref<U> value) const noexcept {
+			return contains_spans<Region>(value);
+		}
+
+		// occurrences of every distinct value within the region gathered in a single pass, in order of first appearance
+		template<zone_region_e Region> inline std::vector<std::pair<T, usize>> histogram() const noexcept {
+			if constexpr (Region == zone_region_e::None) {
+				return {};
+			} else {
+				if constexpr (Region != zone_region_e::Border) {
+					if (cptr<sampler_t<T, Size, BorderSize>> index{ current_sampler() }; index != nullptr) {
+						return index->histogram(samples_interior<Region>(), samples_border<Region>());
 					}
 				}
 
-				return false;
-			} else if constexpr (Region == zone_region_e::Interior) {
-				for (extent_t::scalar_t y{ interior_origin.y }; y <= interior_extent.y; ++y) {
-					for (extent_t::scalar_t x{ interior_origin.x }; x <= interior_extent.x; ++x) {
-						if (cells[x, y] == value) {
-							return true;
+				std::vector<std::pair<T, usize>> buckets{};
+
+				if constexpr (simd::is_vectorizable<T>::value && sizeof(T) == 1) {
+					std::array<usize, 256> tally{};
+					std::array<bool, 256> seen{};
+
+					std::vector<u8> order{};
+
+					for_each_span<Region>([&](cptr<T> data, usize length) -> bool {
+						for (usize x{ 0 }; x < length; ++x) {
+							const u8 key{ std::bit_cast<u8>(data[x]) };
+
+							if (!seen[key]) {
+								seen[key] = true;
+								order.push_back(key);
+							}
+
+							++tally[key];
 						}
+
+						return false;
+					});
+
+					buckets.reserve(order.size());
+
+					for (cauto key : order) {
+						buckets.emplace_back(std::bit_cast<T>(key), tally[key]);
 					}
-				}
+				} else {
+					usize last{ 0 };
 
-				return false;
-			} else if constexpr (Region == zone_region_e::Border) {
-				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
-					if (y < interior_origin.y || y > interior_extent.y) {
-						for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
-							if (cells[x, y] == value) {
-								return true;
+					for_each_span<Region>([&](cptr<T> data, usize length) -> bool {
+						for (usize x{ 0 }; x < length; ++x) {
+							// runs of equal values are common so the previous bucket is tried first
+							if (last < buckets.size() && buckets[last].first == data[x]) {
+								++buckets[last].second;
+								continue;
 							}
-						}
-					} else {
-						for (extent_t::scalar_t i{ 0 }; i < border_size.w; ++i) {
-							if (cells[i, y] == value) {
-								return true;
+
+							last = 0;
+
+							while (last < buckets.size() && !(buckets[last].first == data[x])) {
+								++last;
 							}
-							if (cells[zone_extent.x - i, y] == value) {
-								return true;
+
+							if (last == buckets.size()) {
+								buckets.emplace_back(data[x], 0);
 							}
+
+							++buckets[last].second;
 						}
-					}
+
+						return false;
+					});
 				}
 
-				return false;
-			} else if constexpr (Region == zone_region_e::None) {
-				return false;
+				return buckets;
 			}
-
-			return false;
 		}
 
 		constexpr bool linear_blockage(offset_t origin, offset_t target, cref<T> value, u32 distance) const noexcept {
@@ -2746,99 +3989,113 @@ namespace bleak {
 			}
 		}
 
-		template<bool Simple = false, extent_t AtlasSize>
-		constexpr void draw(cref<atlas_t<AtlasSize>> atlas, cref<camera_t> camera) const noexcept
-			requires is_drawable<T>::value
-		{
-			const offset_t origin{ camera.get_position() };
-			const extent_t camera_extent{ camera.get_extent() };
-
-			if (camera_extent.w == 0 || camera_extent.h == 0 || origin.x > zone_extent.x || origin.y > zone_extent.y) {
-				return;
+		// cells of the zone covered by a viewport grown by margin on every side, or nothing if they do not overlap
+		static constexpr std::optional<rect_t> visible(offset_t origin, extent_t size, extent_t margin = extent_t::Zero) noexcept {
+			if (size.w <= 0 || size.h <= 0) {
+				return std::nullopt;
 			}
 
-			for (offset_t::scalar_t y{ max(offset_t::scalar_t{ 0 }, origin.y) }; y < min(zone_size.h, camera_extent.h); ++y) {
-				for (offset_t::scalar_t x{ max(offset_t::scalar_t{ 0 }, origin.x) }; x < min(zone_size.w, camera_extent.w); ++x) {
-					const offset_t pos{ x, y };
+			const offset_t first{ max<offset_t::scalar_t>(origin.x - margin.w, 0), max<offset_t::scalar_t>(origin.y - margin.h, 0) };
+			const offset_t last{ min<offset_t::scalar_t>(origin.x + size.w + margin.w, zone_size.w) - 1, min<offset_t::scalar_t>(origin.y + size.h + margin.h, zone_size.h) - 1 };
 
-					if constexpr (Simple) {
-						(*this)[pos].draw(atlas, pos, -origin);
-					} else {
-						(*this)[pos].draw(atlas, *this, pos, -origin);
-					}
-				}
+			if (first.x > last.x || first.y > last.y) {
+				return std::nullopt;
 			}
+
+			return rect_t{ first, extent_t{ last.x - first.x + 1, last.y - first.y + 1 } };
 		}
 
-		template<bool Simple = false, extent_t AtlasSize>
-		constexpr void draw(cref<atlas_t<AtlasSize>> atlas, cref<camera_t> camera, offset_t offset) const noexcept
-			requires is_drawable<T>::value
-		{
-			const offset_t origin{ camera.get_position() };
-			const extent_t camera_extent{ camera.get_extent() };
+		static constexpr std::optional<rect_t> visible(cref<camera_t> camera, extent_t margin = extent_t::Zero) noexcept { return visible(camera.get_position(), camera.get_size(), margin); }
 
-			if (camera_extent.w == 0 || camera_extent.h == 0 || origin.x > zone_extent.x || origin.y > zone_extent.y) {
+	  private:
+		// invokes func(pos) over the cells within bounds only, so off-screen cells cost nothing
+		template<typename Func> constexpr void for_each_visible(cref<std::optional<rect_t>> bounds, cref<Func> func) const noexcept {
+			if (!bounds.has_value()) {
 				return;
 			}
 
-			for (offset_t::scalar_t y{ max(offset_t::scalar_t{ 0 }, origin.y) }; y < min(zone_size.h, camera_extent.h); ++y) {
-				for (offset_t::scalar_t x{ max(offset_t::scalar_t{ 0 }, origin.x) }; x < min(zone_size.w, camera_extent.w); ++x) {
-					const offset_t pos{ x, y };
+			const offset_t first{ bounds->origin() };
+			const offset_t last{ bounds->extent() };
 
-					if constexpr (Simple) {
-						(*this)[pos].draw(atlas, pos, -origin + offset);
-					} else {
-						(*this)[pos].draw(atlas, *this, pos, -origin + offset);
-					}
+			for (offset_t::scalar_t y{ first.y }; y <= last.y; ++y) {
+				for (offset_t::scalar_t x{ first.x }; x <= last.x; ++x) {
+					func(offset_t{ x, y });
 				}
 			}
 		}
 
+	  public:
+		// the camera overloads only visit cells within the camera's viewport plus margin, which allows glyphs larger than a cell to bleed in from just off-screen
 		template<bool Simple = false, extent_t AtlasSize>
-		constexpr void draw(cref<atlas_t<AtlasSize>> atlas, cref<camera_t> camera, offset_t offset, offset_t nudge) const noexcept
+		constexpr void draw(cref<atlas_t<AtlasSize>> atlas, cref<camera_t> camera, extent_t margin = extent_t::Zero) const noexcept
 			requires is_drawable<T>::value
 		{
 			const offset_t origin{ camera.get_position() };
-			const extent_t camera_extent{ camera.get_extent() };
 
-			if (camera_extent.w == 0 || camera_extent.h == 0 || origin.x > zone_extent.x || origin.y > zone_extent.y) {
-				return;
-			}
+			for_each_visible(visible(camera, margin), [&](offset_t pos) {
+				if constexpr (Simple) {
+					(*this)[pos].draw(atlas, pos, -origin);
+				} else {
+					(*this)[pos].draw(atlas, *this, pos, -origin);
+				}
+			});
+		}
 
-			for (offset_t::scalar_t y{ max(offset_t::scalar_t{ 0 }, origin.y) }; y < min(zone_size.h, camera_extent.h); ++y) {
-				for (offset_t::scalar_t x{ max(offset_t::scalar_t{ 0 }, origin.x) }; x < min(zone_size.w, camera_extent.w); ++x) {
-					const offset_t pos{ x, y };
+		template<bool Simple = false, extent_t AtlasSize>
+		constexpr void draw(cref<atlas_t<AtlasSize>> atlas, cref<camera_t> camera, offset_t offset, extent_t margin = extent_t::Zero) const noexcept
+			requires is_drawable<T>::value
+		{
+			const offset_t origin{ camera.get_position() };
 
-					if constexpr (Simple) {
-						(*this)[pos].draw(atlas, pos, -origin + offset, nudge);
-					} else {
-						(*this)[pos].draw(atlas, *this, pos, -origin + offset, nudge);
-					}
+			for_each_visible(visible(camera, margin), [&](offset_t pos) {
+				if constexpr (Simple) {
+					(*this)[pos].draw(atlas, pos, -origin + offset);
+				} else {
+					(*this)[pos].draw(atlas, *this, pos, -origin + offset);
 				}
-			}
+			});
 		}
 
 		template<bool Simple = false, extent_t AtlasSize>
-		constexpr void draw(cref<atlas_t<AtlasSize>> atlas, offset_t offset, offset_t origin, extent_t size) const noexcept
+		constexpr void draw(cref<atlas_t<AtlasSize>> atlas, cref<camera_t> camera, offset_t offset, offset_t nudge, extent_t margin = extent_t::Zero) const noexcept
 			requires is_drawable<T>::value
 		{
-			const extent_t camera_extent{ origin + size };
+			const offset_t origin{ camera.get_position() };
 
-			if (camera_extent.w == 0 || camera_extent.h == 0 || origin.x > zone_extent.x || origin.y > zone_extent.y) {
-				return;
-			}
+			for_each_visible(visible(camera, margin), [&](offset_t pos) {
+				if constexpr (Simple) {
+					(*this)[pos].draw(atlas, pos, -origin + offset, nudge);
+				} else {
+					(*this)[pos].draw(atlas, *this, pos, -origin + offset, nudge);
+				}
+			});
+		}
 
-			for (offset_t::scalar_t y{ max(offset_t::scalar_t{ 0 }, origin.y) }; y < min(zone_size.h, camera_extent.h); ++y) {
-				for (offset_t::scalar_t x{ max(offset_t::scalar_t{ 0 }, origin.x) }; x < min(zone_size.w, camera_extent.w); ++x) {
-					const offset_t pos{ x, y };
+		template<bool Simple = false, extent_t AtlasSize>
+		constexpr void draw(cref<atlas_t<AtlasSize>> atlas, offset_t offset, offset_t origin, extent_t size, extent_t margin = extent_t::Zero) const noexcept
+			requires is_drawable<T>::value
+		{
+			for_each_visible(visible(origin, size, margin), [&](offset_t pos) {
+				if constexpr (Simple) {
+					(*this)[pos].draw(atlas, pos, offset);
+				} else {
+					(*this)[pos].draw(atlas, *this, pos, offset);
+				}
+			});
+		}
 
-					if constexpr (Simple) {
-						(*this)[pos].draw(atlas, pos, offset);
-					} else {
-						(*this)[pos].draw(atlas, *this, pos, offset);
-					}
+		// draws the cells of a span taken from this zone, each placed at its position within the zone
+		template<bool Simple = false, extent_t AtlasSize>
+		constexpr void draw(cref<atlas_t<AtlasSize>> atlas, zone_span_t<const T> cells_span, offset_t offset) const noexcept
+			requires is_drawable<T>::value
+		{
+			cells_span.for_each([&](offset_t pos, cref<T> cell) {
+				if constexpr (Simple) {
+					cell.draw(atlas, pos, offset);
+				} else {
+					cell.draw(atlas, *this, pos, offset);
 				}
-			}
+			});
 		}
 
 		constexpr cstr serialize() const noexcept { return reinterpret_cast<cstr>(cells.data_ptr()); }
@@ -2855,6 +4112,277 @@ namespace bleak {
 			return true;
 		}
 
-		constexpr void deserialize(cstr binary_data) noexcept { std::memcpy(reinterpret_cast<str>(cells.data_ptr()), binary_data, cells.byte_size); }
+		constexpr void deserialize(cstr binary_data) noexcept {
+			std::memcpy(reinterpret_cast<str>(cells.data_ptr()), binary_data, cells.byte_size);
+
+			touch();
+		}
+
+		static constexpr codec::header_t header(u64 checksum) noexcept { return codec::header_t{ static_cast<u16>(sizeof(T)), zone_size, border_size, extent_t{ 1, 1 }, checksum }; }
+
+		// taken over the cells in row order so encoded files do not depend on the layout they were written from
+		inline u64 checksum(u64 seed = codec::ChecksumSeed) const noexcept {
+			if constexpr (row_major) {
+				return codec::checksum(seed, reinterpret_cast<cptr<u8>>(cells.data_ptr()), byte_size);
+			} else {
+				for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+					for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+						seed = codec::checksum(seed, reinterpret_cast<cptr<u8>>(&cells[x, y]), sizeof(T));
+					}
+				}
+
+				return seed;
+			}
+		}
+
+		// headerless row-by-row body of the encoded format, shared with region_t
+		inline bool encode_rows(ref<std::ostream> stream) const noexcept {
+			std::vector<T> scratch(row_major ? 0 : zone_size.w);
+
+			for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+				if constexpr (row_major) {
+					codec::encode_row(stream, row_ptr(y), static_cast<usize>(zone_size.w));
+				} else {
+					for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+						scratch[x] = cells[x, y];
+					}
+
+					codec::encode_row(stream, scratch.data(), static_cast<usize>(zone_size.w));
+				}
+			}
+
+			return stream.good();
+		}
+
+		// decodes one row at a time into destination and folds the rows into the running checksum
+		// without a destination the rows are decoded a row at a time aside and only checked, so a load can verify the whole body before it writes a single cell
+		static inline bool decode_rows(ref<std::istream> stream, codec::compression_e compression, ref<u64> checksum, ptr<array_t<T, Size>> destination) noexcept {
+			const bool in_place{ row_major && destination != nullptr };
+
+			std::vector<T> scratch(in_place ? 0 : zone_size.w);
+
+			for (extent_t::scalar_t y{ 0 }; y < zone_size.h; ++y) {
+				const ptr<T> row{ in_place ? destination->data_ptr() + static_cast<usize>(y) * zone_size.w : scratch.data() };
+
+				if (compression == codec::compression_e::RunLength) {
+					if (!codec::decode_row(stream, row, static_cast<usize>(zone_size.w))) {
+						error_log.add("malformed row {} in encoded zone!", y);
+						return false;
+					}
+				} else {
+					stream.read(reinterpret_cast<str>(row), static_cast<std::streamsize>(zone_size.w * sizeof(T)));
+
+					if (!stream.good()) {
+						error_log.add("truncated row {} in encoded zone!", y);
+						return false;
+					}
+				}
+
+				checksum = codec::checksum(checksum, reinterpret_cast<cptr<u8>>(row), zone_size.w * sizeof(T));
+
+				if (!in_place && destination != nullptr) {
+					for (extent_t::scalar_t x{ 0 }; x < zone_size.w; ++x) {
+						(*destination)[x, y] = row[x];
+					}
+				}
+			}
+
+			return true;
+		}
+
+		// decodes a body already verified by a pass without destination straight into the cells, shared with region_t
+		inline bool decode_rows(ref<std::istream> stream, codec::compression_e compression, ref<u64> checksum) noexcept {
+			const bool decoded{ decode_rows(stream, compression, checksum, &cells) };
+
+			touch();
+
+			return decoded;
+		}
+
+		// self-describing run-length encoded counterpart of serialize; encoding streams rows straight from the cells without an intermediate buffer
+		inline bool encode(ref<std::ostream> stream) const noexcept {
+			if (!codec::write_header(stream, header(checksum()))) {
+				return false;
+			}
+
+			return encode_rows(stream);
+		}
+
+		inline bool encode(cref<std::string> path) const noexcept {
+			std::ofstream file{ path, std::ios::out | std::ios::binary };
+
+			if (!file.is_open()) {
+				error_log.add("failed to open \"{}\" for writing!", path);
+				return false;
+			}
+
+			return encode(file);
+		}
+
+		inline bool decode(ref<std::istream> stream) noexcept {
+			codec::header_t file_header{};
+
+			if (!codec::read_header(stream, file_header) || !file_header.matches(header(0))) {
+				return false;
+			}
+
+			// the body is read twice, first to verify it against the checksum and then to decode it in place, so a failed load leaves the zone as it was without holding a copy of it
+			const std::istream::pos_type body{ stream.tellg() };
+
+			if (body == std::istream::pos_type(-1)) {
+				error_log.add("encoded zone must be read from a seekable stream!");
+				return false;
+			}
+
+			u64 running{ codec::ChecksumSeed };
+
+			if (!decode_rows(stream, file_header.compression, running, nullptr)) {
+				return false;
+			}
+
+			if (running != file_header.checksum) {
+				error_log.add("checksum mismatch in encoded zone!");
+				return false;
+			}
+
+			stream.seekg(body);
+
+			if (!stream.good()) {
+				error_log.add("failed to rewind encoded zone!");
+				return false;
+			}
+
+			running = codec::ChecksumSeed;
+
+			if (!decode_rows(stream, file_header.compression, running) || running != file_header.checksum) {
+				error_log.add("encoded zone changed while it was being read!");
+				return false;
+			}
+
+			return true;
+		}
+
+		inline bool decode(cref<std::string> path) noexcept {
+			std::ifstream file{ path, std::ios::in | std::ios::binary };
+
+			if (!file.is_open()) {
+				error_log.add("failed to open \"{}\" for reading!", path);
+				return false;
+			}
+
+			return decode(file);
+		}
+
+		// writes the runs of cells where other differs from this zone into delta, such that applying it here reproduces other
+		// gaps too short to pay for a run header of their own are folded into the surrounding run
+		inline void diff(cref<zone_t<T, Size, BorderSize>> other, ref<zone_delta_t<T>> delta) const noexcept {
+			using run_t = typename zone_delta_t<T>::run_t;
+
+			constexpr usize area{ static_cast<usize>(zone_area) };
+			constexpr usize bridge{ max<usize>(sizeof(run_t) / sizeof(T), 1) };
+			constexpr usize chunk{ max<usize>(memory::CacheLine / sizeof(T), 1) };
+
+			delta.clear();
+
+			cptr<T> lhs{ cells.data_ptr() };
+			cptr<T> rhs{ other.cells.data_ptr() };
+
+			usize index{ 0 };
+
+			while (index < area) {
+				if constexpr (std::is_trivially_copyable<T>::value) {
+					while (index + chunk <= area && std::memcmp(lhs + index, rhs + index, chunk * sizeof(T)) == 0) {
+						index += chunk;
+					}
+
+					if (index >= area) {
+						break;
+					}
+				}
+
+				if (lhs[index] == rhs[index]) {
+					++index;
+					continue;
+				}
+
+				const usize first{ index };
+				usize last{ first + 1 };
+
+				for (index = last; index < area && index < last + bridge; ++index) {
+					if (!(lhs[index] == rhs[index])) {
+						last = index + 1;
+					}
+				}
+
+				delta.runs.push_back(run_t{ static_cast<u32>(first), static_cast<u32>(last - first) });
+				delta.values.insert(delta.values.end(), rhs + first, rhs + last);
+			}
+		}
+
+		inline zone_delta_t<T> diff(cref<zone_t<T, Size, BorderSize>> other) const noexcept {
+			zone_delta_t<T> delta{};
+
+			diff(other, delta);
+
+			return delta;
+		}
+
+		// rejects the whole delta without writing anything if any run falls outside the zone or the values do not cover the runs
+		inline bool apply_delta(cref<zone_delta_t<T>> delta) noexcept {
+			constexpr usize area{ static_cast<usize>(zone_area) };
+
+			usize total{ 0 };
+
+			for (crauto run : delta.runs) {
+				if (static_cast<usize>(run.index) + run.length > area) {
+					error_log.add("delta run at {} exceeds the zone!", run.index);
+					return false;
+				}
+
+				total += run.length;
+			}
+
+			if (total != delta.values.size()) {
+				error_log.add("delta values do not match its runs!");
+				return false;
+			}
+
+			if (delta.empty()) {
+				return true;
+			}
+
+			cptr<T> values{ delta.values.data() };
+
+			for (crauto run : delta.runs) {
+				std::copy_n(values, run.length, cells.data_ptr() + run.index);
+
+				values += run.length;
+
+				if (!tracker) {
+					continue;
+				}
+
+				if constexpr (row_major) {
+					const offset_t first{ array_t<T, Size>::unflatten(run.index) };
+					const offset_t last{ array_t<T, Size>::unflatten(run.index + run.length - 1) };
+
+					if (first.y == last.y) {
+						tracker->mark(first, last);
+					} else {
+						tracker->mark(offset_t{ 0, first.y }, offset_t{ zone_extent.x, last.y });
+					}
+				} else {
+					for (usize i{ run.index }; i < run.index + run.length; ++i) {
+						tracker->mark(array_t<T, Size>::unflatten(i));
+					}
+				}
+			}
+
+			if (sampler) {
+				sampler->invalidate();
+			}
+
+			return true;
+		}
 	};
 } // namespace bleak
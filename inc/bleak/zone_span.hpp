@@ -0,0 +1,183 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <span>
+#include <type_traits>
+
+#include <bleak/concepts.hpp>
+#include <bleak/extent.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/rect.hpp>
+#include <bleak/simd.hpp>
+#include <bleak/utility.hpp>
+
+namespace bleak {
+	// non-owning view of a rectangle of row-major cells; each row is contiguous and consecutive rows lie stride elements apart
+	// T is const for read-only views, which mutable views convert to; views never allocate and are cheap to pass by value
+	template<typename T> struct zone_span_t {
+		using value_type = std::remove_const_t<T>;
+		using row_type = std::span<T>;
+
+		// iterates the rows of the span as contiguous std::spans
+		struct row_iterator {
+			ptr<T> row;
+			usize stride;
+			usize width;
+
+			constexpr row_type operator*() const noexcept { return row_type{ row, width }; }
+
+			constexpr ref<row_iterator> operator++() noexcept {
+				row += stride;
+
+				return *this;
+			}
+
+			constexpr row_iterator operator++(int) noexcept {
+				row_iterator previous{ *this };
+
+				row += stride;
+
+				return previous;
+			}
+
+			constexpr bool operator==(cref<row_iterator> other) const noexcept { return row == other.row; }
+		};
+
+	  private:
+		ptr<T> first;
+
+		// position of the first cell within the array or zone the span was taken from
+		offset_t position;
+		extent_t extent;
+
+		usize stride;
+
+	  public:
+		constexpr zone_span_t() noexcept : first{ nullptr }, position{}, extent{}, stride{ 0 } {}
+
+		constexpr zone_span_t(ptr<T> data, offset_t origin, extent_t size, usize stride) noexcept : first{ data }, position{ origin }, extent{ size }, stride{ stride } {}
+
+		template<typename U>
+			requires(std::is_const<T>::value && std::is_same<const U, T>::value)
+		constexpr zone_span_t(zone_span_t<U> other) noexcept : first{ other.data() }, position{ other.origin() }, extent{ other.size() }, stride{ other.pitch() } {}
+
+		constexpr ptr<T> data() const noexcept { return first; }
+
+		constexpr offset_t origin() const noexcept { return position; }
+
+		constexpr extent_t size() const noexcept { return extent; }
+
+		constexpr usize pitch() const noexcept { return stride; }
+
+		constexpr extent_t::scalar_t width() const noexcept { return extent.w; }
+
+		constexpr extent_t::scalar_t height() const noexcept { return extent.h; }
+
+		constexpr extent_t::product_t area() const noexcept { return extent.area(); }
+
+		constexpr bool empty() const noexcept { return first == nullptr || extent.w <= 0 || extent.h <= 0; }
+
+		// whether the rows follow one another without gaps, allowing the span to be treated as a single run of cells
+		constexpr bool is_contiguous() const noexcept { return stride == static_cast<usize>(extent.w); }
+
+		// the rectangle the span covers within the array or zone it was taken from
+		constexpr rect_t bounds() const noexcept { return rect_t{ position, extent }; }
+
+		constexpr ref<T> operator[](extent_t::scalar_t x, extent_t::scalar_t y) const noexcept { return first[static_cast<usize>(y) * stride + x]; }
+
+		constexpr ref<T> operator[](offset_t offset) const noexcept { return first[static_cast<usize>(offset.y) * stride + offset.x]; }
+
+		constexpr bool valid(offset_t offset) const noexcept { return offset.x >= 0 && offset.y >= 0 && offset.x < extent.w && offset.y < extent.h; }
+
+		constexpr row_type row(extent_t::scalar_t y) const noexcept { return row_type{ first + static_cast<usize>(y) * stride, static_cast<usize>(extent.w) }; }
+
+		constexpr row_iterator begin() const noexcept { return row_iterator{ first, stride, static_cast<usize>(extent.w) }; }
+
+		constexpr row_iterator end() const noexcept { return row_iterator{ empty() ? first : first + static_cast<usize>(extent.h) * stride, stride, static_cast<usize>(extent.w) }; }
+
+		// a view of the rectangle at origin, relative to this span, clipped to the span
+		constexpr zone_span_t subspan(offset_t origin, extent_t size) const noexcept {
+			const offset_t::scalar_t left{ clamp<offset_t::scalar_t>(origin.x, 0, extent.w) };
+			const offset_t::scalar_t top{ clamp<offset_t::scalar_t>(origin.y, 0, extent.h) };
+			const offset_t::scalar_t right{ clamp<offset_t::scalar_t>(origin.x + size.w, left, extent.w) };
+			const offset_t::scalar_t bottom{ clamp<offset_t::scalar_t>(origin.y + size.h, top, extent.h) };
+
+			if (right == left || bottom == top) {
+				return zone_span_t{};
+			}
+
+			return zone_span_t{ first + static_cast<usize>(top) * stride + left, offset_t{ position.x + left, position.y + top }, extent_t{ right - left, bottom - top }, stride };
+		}
+
+		constexpr zone_span_t subspan(cref<rect_t> rect) const noexcept { return subspan(rect.position, rect.size); }
+
+		// invokes func(position, cell) for every cell, where position is within the array or zone the span was taken from
+		template<typename Func> constexpr void for_each(cref<Func> func) const noexcept {
+			if (empty()) {
+				return;
+			}
+
+			for (extent_t::scalar_t y{ 0 }; y < extent.h; ++y) {
+				const ptr<T> cells{ first + static_cast<usize>(y) * stride };
+
+				for (extent_t::scalar_t x{ 0 }; x < extent.w; ++x) {
+					func(offset_t{ position.x + x, position.y + y }, cells[x]);
+				}
+			}
+		}
+
+		template<typename U>
+			requires(!std::is_const<T>::value && std::is_assignable<ref<T>, cref<U>>::value)
+		constexpr zone_span_t fill(cref<U> value) const noexcept {
+			for (const row_type cells : *this) {
+				for (ref<T> cell : cells) {
+					cell = value;
+				}
+			}
+
+			return *this;
+		}
+
+		// counts row by row, or in a single pass when the rows are contiguous
+		template<typename U>
+			requires is_equatable<value_type, U>::value
+		inline usize count(cref<U> value) const noexcept {
+			if (empty()) {
+				return 0;
+			}
+
+			if (is_contiguous()) {
+				return simd::count(static_cast<cptr<value_type>>(first), static_cast<usize>(area()), value);
+			}
+
+			usize total{ 0 };
+
+			for (const row_type cells : *this) {
+				total += simd::count(static_cast<cptr<value_type>>(cells.data()), cells.size(), value);
+			}
+
+			return total;
+		}
+
+		template<typename U>
+			requires is_equatable<value_type, U>::value
+		inline bool contains(cref<U> value) const noexcept {
+			if (empty()) {
+				return false;
+			}
+
+			if (is_contiguous()) {
+				return simd::contains(static_cast<cptr<value_type>>(first), static_cast<usize>(area()), value);
+			}
+
+			for (const row_type cells : *this) {
+				if (simd::contains(static_cast<cptr<value_type>>(cells.data()), cells.size(), value)) {
+					return true;
+				}
+			}
+
+			return false;
+		}
+	};
+} // namespace bleak
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <bleak/typedef.hpp>
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include <bleak/extent.hpp>
+#include <bleak/log.hpp>
+#include <bleak/mapped_file.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/zone.hpp>
+
+namespace bleak {
+	// read-only zone backed by a mapping of the raw serialize format; the first write promotes it to an owned zone_t and later reads follow the copy
+	template<typename T, extent_t Size, extent_t BorderSize = extent_t::Zero> struct zone_view_t {
+		using zone_type = zone_t<T, Size, BorderSize>;
+
+		static constexpr extent_t zone_size{ Size };
+		static constexpr extent_t::product_t zone_area{ zone_type::zone_area };
+		static constexpr usize byte_size{ zone_type::byte_size };
+
+	  private:
+		std::shared_ptr<const mapped_file_t> mapping;
+		cptr<T> cells;
+
+		std::unique_ptr<zone_type> promoted;
+
+		// the mapping holds cells in the storage order of the zone's layout, exactly as serialize wrote them
+		static constexpr usize flatten(offset_t::scalar_t x, offset_t::scalar_t y) noexcept { return array_t<T, Size>::flatten(x, y); }
+
+	  public:
+		inline zone_view_t() noexcept : mapping{}, cells{ nullptr }, promoted{} {}
+
+		inline zone_view_t(cref<std::string> path) noexcept : zone_view_t{ std::make_shared<const mapped_file_t>(path), 0 } {}
+
+		// views the zone stored at the byte offset of a shared mapping, allowing a region file to be mapped once for all of its zones
+		inline zone_view_t(std::shared_ptr<const mapped_file_t> file, usize offset) noexcept : mapping{ std::move(file) }, cells{ nullptr }, promoted{} {
+			if (mapping == nullptr || !mapping->is_open()) {
+				return;
+			}
+
+			if (mapping->size() < offset + byte_size) {
+				error_log.add("byte size mismatch between file and map!");
+				return;
+			}
+
+			if (offset % alignof(T) != 0) {
+				error_log.add("zone at byte offset {} is misaligned for its cells!", offset);
+				return;
+			}
+
+			cells = reinterpret_cast<cptr<T>>(mapping->data() + offset);
+		}
+
+		inline zone_view_t(cref<zone_view_t> other) noexcept : mapping{ other.mapping }, cells{ other.cells }, promoted{ other.promoted ? std::make_unique<zone_type>(*other.promoted) : nullptr } {}
+
+		inline zone_view_t(rval<zone_view_t> other) noexcept : mapping{ std::move(other.mapping) }, cells{ std::exchange(other.cells, nullptr) }, promoted{ std::move(other.promoted) } {}
+
+		inline ref<zone_view_t> operator=(cref<zone_view_t> other) noexcept {
+			if (this != &other) {
+				mapping = other.mapping;
+				cells = other.cells;
+				promoted = other.promoted ? std::make_unique<zone_type>(*other.promoted) : nullptr;
+			}
+
+			return *this;
+		}
+
+		inline ref<zone_view_t> operator=(rval<zone_view_t> other) noexcept {
+			if (this != &other) {
+				mapping = std::move(other.mapping);
+				cells = std::exchange(other.cells, nullptr);
+				promoted = std::move(other.promoted);
+			}
+
+			return *this;
+		}
+
+		inline ~zone_view_t() noexcept {}
+
+		constexpr bool is_valid() const noexcept { return cells != nullptr || promoted != nullptr; }
+
+		constexpr bool is_promoted() const noexcept { return promoted != nullptr; }
+
+		constexpr cref<T> operator[](extent_t::product_t index) const noexcept { return promoted ? std::as_const(*promoted)[index] : cells[index]; }
+
+		constexpr cref<T> operator[](extent_t::scalar_t x, extent_t::scalar_t y) const noexcept { return promoted ? std::as_const(*promoted)[x, y] : cells[flatten(x, y)]; }
+
+		constexpr cref<T> operator[](offset_t position) const noexcept { return promoted ? std::as_const(*promoted)[position] : cells[flatten(position.x, position.y)]; }
+
+		// copies the mapped cells into an owned zone on first use; the mapping is released once nothing else shares it
+		// subscripts stay read-only so that reading a view never copies it, and writes go through set or the zone returned here
+		inline ref<zone_type> promote() noexcept {
+			if (!promoted) {
+				promoted = std::make_unique<zone_type>();
+
+				if (cells != nullptr) {
+					promoted->deserialize(reinterpret_cast<cstr>(cells));
+				}
+
+				cells = nullptr;
+				mapping.reset();
+			}
+
+			return *promoted;
+		}
+
+		constexpr ref<zone_view_t> set(offset_t position, cref<T> value) noexcept {
+			promote().set(position, value);
+
+			return *this;
+		}
+
+		// hands the promoted zone over to the caller, promoting first if nothing has been written yet
+		inline std::unique_ptr<zone_type> release() noexcept {
+			promote();
+
+			return std::move(promoted);
+		}
+	};
+} // namespace bleak
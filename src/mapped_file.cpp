@@ -0,0 +1,88 @@
+#include <bleak/mapped_file.hpp>
+
+#if defined(_WIN32)
+	#ifndef WIN32_LEAN_AND_MEAN
+		#define WIN32_LEAN_AND_MEAN
+	#endif
+
+	#ifndef NOMINMAX
+		#define NOMINMAX
+	#endif
+
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+namespace bleak::mapping {
+	status_e map(cref<std::string> path, ref<cstr> address, ref<usize> length) noexcept {
+#if defined(_WIN32)
+		HANDLE file{ CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr) };
+
+		if (file == INVALID_HANDLE_VALUE) {
+			return status_e::Unopenable;
+		}
+
+		LARGE_INTEGER file_size{};
+
+		if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+			CloseHandle(file);
+			return status_e::Empty;
+		}
+
+		HANDLE mapping{ CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr) };
+
+		CloseHandle(file);
+
+		if (mapping == nullptr) {
+			return status_e::Unmappable;
+		}
+
+		address = static_cast<cstr>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+
+		CloseHandle(mapping);
+
+		if (address == nullptr) {
+			return status_e::Unmappable;
+		}
+
+		length = static_cast<usize>(file_size.QuadPart);
+#else
+		const int descriptor{ open(path.c_str(), O_RDONLY) };
+
+		if (descriptor == -1) {
+			return status_e::Unopenable;
+		}
+
+		struct stat status{};
+
+		if (fstat(descriptor, &status) == -1 || status.st_size == 0) {
+			close(descriptor);
+			return status_e::Empty;
+		}
+
+		ptr<void> mapped{ mmap(nullptr, static_cast<usize>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0) };
+
+		close(descriptor);
+
+		if (mapped == MAP_FAILED) {
+			return status_e::Unmappable;
+		}
+
+		address = static_cast<cstr>(mapped);
+		length = static_cast<usize>(status.st_size);
+#endif
+		return status_e::Mapped;
+	}
+
+	void unmap(cstr address, [[maybe_unused]] usize length) noexcept {
+#if defined(_WIN32)
+		UnmapViewOfFile(address);
+#else
+		munmap(const_cast<str>(address), length);
+#endif
+	}
+} // namespace bleak::mapping
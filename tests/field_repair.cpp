@@ -0,0 +1,124 @@
+#include <bleak/typedef.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+#include <bleak/extent.hpp>
+#include <bleak/field.hpp>
+#include <bleak/offset.hpp>
+#include <bleak/zone.hpp>
+
+using namespace bleak;
+
+// repairs after random edits of the zone and goals must leave the same distances as recalculating from scratch, including when the goals hold differing values
+
+static constexpr extent_t Size{ 33, 27 };
+
+static constexpr usize Seeds{ 30 };
+static constexpr usize Edits{ 200 };
+
+struct blockage_t {
+	std::vector<offset_t> positions;
+
+	constexpr bool contains(offset_t position) const noexcept { return std::find(positions.begin(), positions.end(), position) != positions.end(); }
+};
+
+template<distance_function_e DistanceFunction, typename D, bool FixedPoint = false> static bool check(u32 seed) noexcept {
+	using field_type = field_t<D, DistanceFunction, Size, extent_t::Zero, FixedPoint>;
+
+	std::mt19937 generator{ seed };
+
+	const auto random_position{ [&]() -> offset_t { return offset_t{ static_cast<offset_t::scalar_t>(generator() % Size.w), static_cast<offset_t::scalar_t>(generator() % Size.h) }; } };
+
+	zone_t<u8, Size> zone{};
+
+	for (offset_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+		for (offset_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+			zone[x, y] = generator() % 100 < 35 ? 1 : 0;
+		}
+	}
+
+	blockage_t blockage{};
+
+	for (usize i{ 0 }; i < 15; ++i) {
+		blockage.positions.push_back(random_position());
+	}
+
+	const goal_t<D> first{ D{ 0 }, random_position() };
+	const goal_t<D> second{ D{ 7 }, random_position() };
+	const goal_t<D> third{ D{ 3 }, random_position() };
+
+	field_type repaired{ first, second, third };
+	field_type recalculated{ first, second, third };
+
+	std::vector<offset_t> movable{ second.position, third.position };
+
+	repaired.template recalculate<zone_region_e::All>(zone, u8{ 0 }, blockage);
+
+	for (usize edit{ 0 }; edit < Edits; ++edit) {
+		switch (generator() % 4) {
+			case 0: {
+				const offset_t position{ random_position() };
+
+				zone[position] = zone[position] == 0 ? 1 : 0;
+				repaired.template repair<zone_region_e::All>(zone, u8{ 0 }, position, blockage);
+				break;
+			}
+			case 1: {
+				const offset_t position{ random_position() };
+
+				if (repaired.template add<zone_region_e::All>(zone, u8{ 0 }, position, blockage)) {
+					recalculated.add(position);
+				}
+				break;
+			}
+			case 2: {
+				rauto from{ movable[generator() % movable.size()] };
+				const offset_t to{ random_position() };
+
+				if (repaired.template update<zone_region_e::All>(zone, u8{ 0 }, from, to, blockage)) {
+					recalculated.update(from, to);
+					from = to;
+				}
+				break;
+			}
+			default: {
+				const offset_t position{ random_position() };
+
+				if (std::find(movable.begin(), movable.end(), position) == movable.end() && repaired.template remove<zone_region_e::All>(zone, u8{ 0 }, position, blockage)) {
+					recalculated.remove(position);
+				}
+				break;
+			}
+		}
+
+		recalculated.template recalculate<zone_region_e::All>(zone, u8{ 0 }, blockage);
+
+		for (offset_t::scalar_t y{ 0 }; y < Size.h; ++y) {
+			for (offset_t::scalar_t x{ 0 }; x < Size.w; ++x) {
+				const offset_t position{ x, y };
+
+				if (repaired.at(position) != recalculated.at(position)) {
+					std::fprintf(stderr, "seed %u, edit %zu: repaired %g but recalculated %g at (%d, %d)\n", seed, edit, static_cast<f64>(repaired.at(position)), static_cast<f64>(recalculated.at(position)), x, y);
+					return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+int main() {
+	for (u32 seed{ 0 }; seed < Seeds; ++seed) {
+		if (!check<distance_function_e::Manhattan, f32>(seed) || !check<distance_function_e::Chebyshev, i32>(seed) || !check<distance_function_e::Octile, f32>(seed) || !check<distance_function_e::Octile, i32, true>(seed)) {
+			return EXIT_FAILURE;
+		}
+	}
+
+	return EXIT_SUCCESS;
+}